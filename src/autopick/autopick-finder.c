@@ -8,19 +8,220 @@
 #include "autopick/autopick-finder.h"
 #include "autopick/autopick-dirty-flags.h"
 #include "autopick/autopick-entry.h"
+#include "autopick/autopick-flags-table.h"
+#include "autopick/autopick-key-flag-process.h"
 #include "autopick/autopick-matcher.h"
+#include "autopick/autopick-name-matcher.h"
 #include "core/show-file.h"
 #include "flavor/flavor-describer.h"
 #include "flavor/object-flavor-types.h"
 #include "floor/floor-object.h"
+#include "inventory/inventory-slot-types.h"
 #include "io/input-key-acceptor.h"
 #include "main/sound-of-music.h"
 #include "object/item-use-flags.h"
+#include "object/object-kind.h"
+#include "player/player-classes-types.h"
+#include "specific-object/bow.h"
 #include "term/screen-processor.h"
 #include "term/term-color-types.h"
 #include "util/int-char-converter.h"
 #include "util/string-processor.h"
 
+/* Number of tval buckets in the autopick rule index */
+#define AUTOPICK_INDEX_TVALS 256
+
+/* Number of entries in the autopick match cache (must be a power of 2) */
+#define AUTOPICK_CACHE_SIZE 256
+
+/*
+ * Autopick match cache entry.
+ * Remembers the result of find_autopick_list() for an object as long as
+ * the object itself, the aware/tried state of its kind and the generation are unchanged.
+ */
+typedef struct autopick_cache_type {
+    object_type *o_ptr;
+    object_type copy;
+    bool aware;
+    bool tried;
+    u32b generation;
+    int result;
+} autopick_cache_type;
+
+/*
+ * Autopick rule index.
+ * Rules whose match does not depend on the tval are listed in autopick_any_rules[],
+ * the others in the bucket of every tval they can match.
+ * Both lists keep rule numbers in ascending order so that the first match wins as before.
+ */
+static bool autopick_index_valid = FALSE;
+static int *autopick_any_rules = NULL;
+static int autopick_any_num = 0;
+static int autopick_any_size = 0;
+static int *autopick_tval_rules = NULL;
+static int autopick_tval_size = 0;
+static int autopick_tval_begin[AUTOPICK_INDEX_TVALS + 1];
+static bool *autopick_volatile = NULL; /* The match of the rule depends on more than the object */
+static int autopick_volatile_size = 0;
+
+static autopick_cache_type autopick_cache[AUTOPICK_CACHE_SIZE];
+static u32b autopick_cache_generation = 1;
+
+/*!
+ * @brief 自動拾いの一致結果のキャッシュを捨てる / Discard the autopick match cache
+ * @return なし
+ * @details
+ * アイテム名の表記に影響するオプションを変更したら呼ぶこと。
+ */
+void reset_autopick_match_cache(void) { autopick_cache_generation++; }
+
+/*!
+ * @brief 自動拾い規則の索引を捨てる / Discard the autopick rule index
+ * @return なし
+ * @details
+ * autopick_list[] を変更したら呼ぶこと。索引は次の検索時に作り直される。
+ */
+void reset_autopick_index(void)
+{
+    autopick_index_valid = FALSE;
+    reset_autopick_match_cache();
+}
+
+/*!
+ * @brief 自動拾い規則が一致しうるtvalを調べる / Find the tvals an autopick rule can match
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param entry 自動拾い規則
+ * @param tvals tvalごとに一致しうるかを返す配列
+ * @return 一致しうるtvalの数
+ */
+static int check_autopick_tvals(player_type *player_ptr, autopick_type *entry, bool *tvals)
+{
+    int num = 0;
+    for (int tval = 0; tval < AUTOPICK_INDEX_TVALS; tval++) {
+        tvals[tval] = is_autopick_tval_match(player_ptr, entry, (tval_type)tval);
+        if (tvals[tval])
+            num++;
+    }
+
+    return num;
+}
+
+/*!
+ * @brief 自動拾い規則の一致がアイテム以外の状態に左右されるかを返す / Check whether the match of an autopick rule depends on more than the object
+ * @param entry 自動拾い規則
+ * @return 所持品、賞金首、クエストや魔法領域に左右されるならTRUE
+ */
+static bool is_volatile_autopick_entry(autopick_type *entry)
+{
+    return IS_FLG(FLG_COLLECTING) || IS_FLG(FLG_WANTED) || IS_FLG(FLG_BOOSTED) || IS_FLG(FLG_UNREADABLE) || IS_FLG(FLG_REALM1)
+        || IS_FLG(FLG_REALM2);
+}
+
+/*!
+ * @brief アイテムの一致結果をキャッシュできるかを返す / Check whether the match result of an object can be cached
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param o_ptr アイテムへの参照ポインタ
+ * @return キャッシュできるならTRUE
+ * @details
+ * 射撃の威力が表記される矢弾と忍者の鉄のスパイクはアイテム名がプレーヤーの状態に左右されるため除く。
+ */
+static bool is_cacheable_autopick_object(player_type *player_ptr, object_type *o_ptr)
+{
+    object_type *bow_ptr = &player_ptr->inventory_list[INVEN_BOW];
+    if ((bow_ptr->k_idx != 0) && (o_ptr->tval == bow_tval_ammo(bow_ptr)))
+        return FALSE;
+
+    return (player_ptr->pclass != CLASS_NINJA) || (o_ptr->tval != TV_SPIKE);
+}
+
+/*!
+ * @brief 自動拾いの一致結果のキャッシュを引く / Look up the autopick match cache
+ * @param cache_ptr キャッシュの要素
+ * @param o_ptr アイテムへの参照ポインタ
+ * @return キャッシュが有効ならTRUE
+ */
+static bool is_autopick_cache_hit(autopick_cache_type *cache_ptr, object_type *o_ptr)
+{
+    object_kind *k_ptr = &k_info[o_ptr->k_idx];
+    return (cache_ptr->o_ptr == o_ptr) && (cache_ptr->generation == autopick_cache_generation) && (cache_ptr->aware == k_ptr->aware)
+        && (cache_ptr->tried == k_ptr->tried) && !memcmp(&cache_ptr->copy, o_ptr, sizeof(object_type));
+}
+
+/*!
+ * @brief 自動拾いの一致結果をキャッシュに記録する / Store a match result in the autopick match cache
+ * @param cache_ptr キャッシュの要素
+ * @param o_ptr アイテムへの参照ポインタ
+ * @param result 自動拾いの登録番号、なかったら-1
+ * @return なし
+ */
+static void store_autopick_cache(autopick_cache_type *cache_ptr, object_type *o_ptr, int result)
+{
+    object_kind *k_ptr = &k_info[o_ptr->k_idx];
+    cache_ptr->o_ptr = o_ptr;
+    (void)memcpy(&cache_ptr->copy, o_ptr, sizeof(object_type));
+    cache_ptr->aware = k_ptr->aware;
+    cache_ptr->tried = k_ptr->tried;
+    cache_ptr->generation = autopick_cache_generation;
+    cache_ptr->result = result;
+}
+
+/*!
+ * @brief 自動拾い規則の索引を作る / Build the autopick rule index
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ */
+static void build_autopick_index(player_type *player_ptr)
+{
+    if (autopick_any_rules) {
+        C_KILL(autopick_any_rules, autopick_any_size, int);
+        C_KILL(autopick_tval_rules, autopick_tval_size, int);
+        C_KILL(autopick_volatile, autopick_volatile_size, bool);
+    }
+
+    bool tvals[AUTOPICK_INDEX_TVALS];
+    int count[AUTOPICK_INDEX_TVALS];
+    (void)C_WIPE(count, AUTOPICK_INDEX_TVALS, int);
+    int any_num = 0;
+    for (int i = 0; i < max_autopick; i++) {
+        if (check_autopick_tvals(player_ptr, &autopick_list[i], tvals) == AUTOPICK_INDEX_TVALS) {
+            any_num++;
+            continue;
+        }
+
+        for (int tval = 0; tval < AUTOPICK_INDEX_TVALS; tval++)
+            if (tvals[tval])
+                count[tval]++;
+    }
+
+    autopick_tval_begin[0] = 0;
+    for (int tval = 0; tval < AUTOPICK_INDEX_TVALS; tval++)
+        autopick_tval_begin[tval + 1] = autopick_tval_begin[tval] + count[tval];
+
+    autopick_any_size = any_num + 1;
+    autopick_tval_size = autopick_tval_begin[AUTOPICK_INDEX_TVALS] + 1;
+    autopick_volatile_size = max_autopick + 1;
+    C_MAKE(autopick_any_rules, autopick_any_size, int);
+    C_MAKE(autopick_tval_rules, autopick_tval_size, int);
+    C_MAKE(autopick_volatile, autopick_volatile_size, bool);
+
+    autopick_any_num = 0;
+    (void)C_WIPE(count, AUTOPICK_INDEX_TVALS, int);
+    for (int i = 0; i < max_autopick; i++) {
+        autopick_volatile[i] = is_volatile_autopick_entry(&autopick_list[i]);
+        if (check_autopick_tvals(player_ptr, &autopick_list[i], tvals) == AUTOPICK_INDEX_TVALS) {
+            autopick_any_rules[autopick_any_num++] = i;
+            continue;
+        }
+
+        for (int tval = 0; tval < AUTOPICK_INDEX_TVALS; tval++)
+            if (tvals[tval])
+                autopick_tval_rules[autopick_tval_begin[tval] + count[tval]++] = i;
+    }
+
+    build_autopick_name_matcher();
+    autopick_index_valid = TRUE;
+}
+
 /*
  * @brief 与えられたアイテムが自動拾いのリストに登録されているかどうかを検索する
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -29,6 +230,9 @@
  * @details
  * A function for Auto-picker/destroyer
  * Examine whether the object matches to the list of keywords or not.
+ * Only the rules listed in the index for the tval of the object and
+ * whose keyword is found in the name of the object are examined.
+ * The result is cached until the object or the autopick list changes.
  */
 int find_autopick_list(player_type *player_ptr, object_type *o_ptr)
 {
@@ -36,15 +240,49 @@ int find_autopick_list(player_type *player_ptr, object_type *o_ptr)
     if (o_ptr->tval == TV_GOLD)
         return -1;
 
+    if (!autopick_index_valid)
+        build_autopick_index(player_ptr);
+
+    int *tval_rules = &autopick_tval_rules[autopick_tval_begin[o_ptr->tval]];
+    int tval_num = autopick_tval_begin[o_ptr->tval + 1] - autopick_tval_begin[o_ptr->tval];
+    if (autopick_any_num + tval_num == 0)
+        return -1;
+
+    autopick_cache_type *cache_ptr = &autopick_cache[((size_t)o_ptr / sizeof(object_type)) & (AUTOPICK_CACHE_SIZE - 1)];
+    if (is_autopick_cache_hit(cache_ptr, o_ptr))
+        return cache_ptr->result;
+
     describe_flavor(player_ptr, o_name, o_ptr, (OD_NO_FLAVOR | OD_OMIT_PREFIX | OD_NO_PLURAL));
     str_tolower(o_name);
-    for (int i = 0; i < max_autopick; i++) {
+    match_autopick_names(o_name);
+    bool cacheable = is_cacheable_autopick_object(player_ptr, o_ptr);
+    int result = -1;
+    int any = 0;
+    int tv = 0;
+    while ((any < autopick_any_num) || (tv < tval_num)) {
+        int i;
+        if ((tv >= tval_num) || ((any < autopick_any_num) && (autopick_any_rules[any] < tval_rules[tv])))
+            i = autopick_any_rules[any++];
+        else
+            i = tval_rules[tv++];
+
+        if (!is_autopick_name_matched(i))
+            continue;
+
+        if (autopick_volatile[i])
+            cacheable = FALSE;
+
         autopick_type *entry = &autopick_list[i];
-        if (is_autopick_match(player_ptr, o_ptr, entry, o_name))
-            return i;
+        if (is_autopick_match_except_name(player_ptr, o_ptr, entry)) {
+            result = i;
+            break;
+        }
     }
 
-    return -1;
+    if (cacheable)
+        store_autopick_cache(cache_ptr, o_ptr, result);
+
+    return result;
 }
 
 /*
@@ -4,6 +4,8 @@
 #include "autopick/autopick-util.h"
 #include "system/object-type-definition.h"
 
+void reset_autopick_match_cache(void);
+void reset_autopick_index(void);
 int find_autopick_list(player_type *player_ptr, object_type *o_ptr);
 bool get_object_for_search(player_type *player_ptr, object_type **o_handle, concptr *search_strp);
 bool get_destroyed_object_for_search(player_type *player_ptr, object_type **o_handle, concptr *search_strp);
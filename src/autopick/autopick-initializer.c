@@ -1,5 +1,6 @@
 ﻿#include "autopick/autopick-initializer.h"
 #include "autopick/autopick-entry.h"
+#include "autopick/autopick-finder.h"
 #include "autopick/autopick-util.h"
 #include "system/angband.h"
 
@@ -25,4 +26,5 @@ void init_autopick(void)
 	max_autopick = 0;
 	autopick_new_entry(&entry, easy_autopick_inscription, TRUE);
 	autopick_list[max_autopick++] = entry;
+	reset_autopick_index();
 }
@@ -19,6 +19,7 @@
 #include "object-hook/hook-enchant.h"
 #include "object-hook/hook-quest.h"
 #include "object-hook/hook-weapon.h"
+#include "object/object-generator.h"
 #include "object/object-kind.h"
 #include "object/object-stack.h"
 #include "object/object-value.h"
@@ -29,11 +30,26 @@
 
 /*
  * A function for Auto-picker/destroyer
- * Examine whether the object matches to the entry
+ * Examine whether the name of the object matches to the entry
  */
-bool is_autopick_match(player_type *player_ptr, object_type *o_ptr, autopick_type *entry, concptr o_name)
+bool is_autopick_name_match(autopick_type *entry, concptr o_name)
 {
 	concptr ptr = entry->name;
+	if (*ptr == '^')
+	{
+		ptr++;
+		return !strncmp(o_name, ptr, strlen(ptr));
+	}
+
+	return angband_strstr(o_name, ptr) != NULL;
+}
+
+/*
+ * A function for Auto-picker/destroyer
+ * Examine whether the object matches to the entry except for the name
+ */
+bool is_autopick_match_except_name(player_type *player_ptr, object_type *o_ptr, autopick_type *entry)
+{
 	if (IS_FLG(FLG_UNAWARE) && object_is_aware(o_ptr))
 		return FALSE;
 
@@ -347,16 +363,6 @@ bool is_autopick_match(player_type *player_ptr, object_type *o_ptr, autopick_typ
 			return FALSE;
 	}
 
-	if (*ptr == '^')
-	{
-		ptr++;
-		if (strncmp(o_name, ptr, strlen(ptr))) return FALSE;
-	}
-	else
-	{
-		if (!angband_strstr(o_name, ptr)) return FALSE;
-	}
-
 	if (!IS_FLG(FLG_COLLECTING)) return TRUE;
 
 	for (int j = 0; j < INVEN_PACK; j++)
@@ -373,3 +379,84 @@ bool is_autopick_match(player_type *player_ptr, object_type *o_ptr, autopick_typ
 
 	return FALSE;
 }
+
+/*
+ * A function for Auto-picker/destroyer
+ * Examine whether the object matches to the entry
+ */
+bool is_autopick_match(player_type *player_ptr, object_type *o_ptr, autopick_type *entry, concptr o_name)
+{
+	return is_autopick_match_except_name(player_ptr, o_ptr, entry) && is_autopick_name_match(entry, o_name);
+}
+
+/*
+ * A function for Auto-picker/destroyer
+ * Examine whether an object of the given tval can ever match the entry.
+ * Only the conditions decided by the tval alone are checked here,
+ * so keep this in sync with is_autopick_match().
+ */
+bool is_autopick_tval_match(player_type *player_ptr, autopick_type *entry, tval_type tval)
+{
+	object_type forge;
+	object_type *o_ptr = &forge;
+	object_wipe(o_ptr);
+	o_ptr->tval = tval;
+
+	if (IS_FLG(FLG_BOOSTED) && !object_is_melee_weapon(o_ptr))
+		return FALSE;
+
+	if ((IS_FLG(FLG_GOOD) || IS_FLG(FLG_NAMELESS) || IS_FLG(FLG_AVERAGE))
+		&& !object_is_equipment(o_ptr))
+		return FALSE;
+
+	if (IS_FLG(FLG_UNIQUE) && tval != TV_CORPSE && tval != TV_STATUE)
+		return FALSE;
+
+	if (IS_FLG(FLG_HUMAN) && tval != TV_CORPSE)
+		return FALSE;
+
+	if ((IS_FLG(FLG_UNREADABLE) || IS_FLG(FLG_FIRST) || IS_FLG(FLG_SECOND)
+		|| IS_FLG(FLG_THIRD) || IS_FLG(FLG_FOURTH)) && tval < TV_LIFE_BOOK)
+		return FALSE;
+
+	if (IS_FLG(FLG_WEAPONS))
+		return object_is_weapon(player_ptr, o_ptr);
+	else if (IS_FLG(FLG_FAVORITE_WEAPONS))
+		return TRUE;
+	else if (IS_FLG(FLG_ARMORS))
+		return object_is_armour(player_ptr, o_ptr);
+	else if (IS_FLG(FLG_MISSILES))
+		return object_is_ammo(o_ptr);
+	else if (IS_FLG(FLG_DEVICES))
+		return tval == TV_SCROLL || tval == TV_STAFF || tval == TV_WAND || tval == TV_ROD;
+	else if (IS_FLG(FLG_LIGHTS))
+		return tval == TV_LITE;
+	else if (IS_FLG(FLG_JUNKS))
+		return tval == TV_SKELETON || tval == TV_BOTTLE || tval == TV_JUNK || tval == TV_STATUE;
+	else if (IS_FLG(FLG_CORPSES))
+		return tval == TV_CORPSE || tval == TV_SKELETON;
+	else if (IS_FLG(FLG_SPELLBOOKS))
+		return tval >= TV_LIFE_BOOK;
+	else if (IS_FLG(FLG_HAFTED))
+		return tval == TV_HAFTED;
+	else if (IS_FLG(FLG_SHIELDS))
+		return tval == TV_SHIELD;
+	else if (IS_FLG(FLG_BOWS))
+		return tval == TV_BOW;
+	else if (IS_FLG(FLG_RINGS))
+		return tval == TV_RING;
+	else if (IS_FLG(FLG_AMULETS))
+		return tval == TV_AMULET;
+	else if (IS_FLG(FLG_SUITS))
+		return tval == TV_DRAG_ARMOR || tval == TV_HARD_ARMOR || tval == TV_SOFT_ARMOR;
+	else if (IS_FLG(FLG_CLOAKS))
+		return tval == TV_CLOAK;
+	else if (IS_FLG(FLG_HELMS))
+		return tval == TV_CROWN || tval == TV_HELM;
+	else if (IS_FLG(FLG_GLOVES))
+		return tval == TV_GLOVES;
+	else if (IS_FLG(FLG_BOOTS))
+		return tval == TV_BOOTS;
+
+	return TRUE;
+}
@@ -2,5 +2,9 @@
 
 #include "system/angband.h"
 #include "autopick/autopick-util.h"
+#include "object/tval-types.h"
 
+bool is_autopick_name_match(autopick_type *entry, concptr o_name);
+bool is_autopick_match_except_name(player_type *player_ptr, object_type *o_ptr, autopick_type *entry);
 bool is_autopick_match(player_type *player_ptr, object_type *o_ptr, autopick_type *entry, concptr o_name);
+bool is_autopick_tval_match(player_type *player_ptr, autopick_type *entry, tval_type tval);
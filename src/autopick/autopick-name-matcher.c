@@ -0,0 +1,232 @@
+﻿/*!
+ * @brief 自動拾いのキーワードをまとめて検索する / Aho-Corasick automaton for the names of autopick entries
+ * @date 2026/10/16
+ * @details
+ * 全ての自動拾い規則のキーワードを一つのオートマトンに登録し、
+ * アイテム名を一度走査するだけでキーワードが一致する規則を全て求める。
+ * 漢字の2バイト目から始まる一致は angband_strstr() と同じく数えない。
+ */
+
+#include "autopick/autopick-name-matcher.h"
+
+/*
+ * Node of the automaton.
+ * Children are kept in a sibling list except for the root, which has a table.
+ */
+typedef struct autopick_name_node {
+    int child; /* First child, or -1 */
+    int sibling; /* Next sibling, or -1 */
+    int fail; /* Longest proper suffix in the trie */
+    int output; /* Nearest node on the fail chain with rules, or -1 */
+    int rule; /* First rule whose keyword ends here, or -1 */
+    int depth; /* Length of the keyword ending here */
+    byte c;
+} autopick_name_node;
+
+static autopick_name_node *name_nodes = NULL;
+static int name_node_size = 0;
+static int name_root_next[256];
+static int *name_rule_next = NULL; /* Next rule ending at the same node, or -1 */
+static bool *name_rule_anchored = NULL; /* The keyword starts with '^' */
+static u32b *name_rule_stamp = NULL; /* Equals name_stamp if the rule matched the last name */
+static int name_rule_size = 0;
+static u32b name_stamp = 0;
+
+/*!
+ * @brief 子ノードを探す / Find the child of a node
+ * @param node ノード番号
+ * @param c 文字
+ * @return 子ノードの番号、なければ-1
+ */
+static int find_name_child(int node, byte c)
+{
+    if (node == 0)
+        return name_root_next[c];
+
+    for (int child = name_nodes[node].child; child >= 0; child = name_nodes[child].sibling)
+        if (name_nodes[child].c == c)
+            return child;
+
+    return -1;
+}
+
+/*!
+ * @brief キーワードをトライ木に登録する / Add a keyword to the trie
+ * @param keyword キーワード
+ * @param node_num 使用済みのノード数
+ * @return キーワードの末尾のノード番号
+ */
+static int add_name_keyword(concptr keyword, int *node_num)
+{
+    int node = 0;
+    for (concptr s = keyword; *s; s++) {
+        byte c = (byte)*s;
+        int child = find_name_child(node, c);
+        if (child < 0) {
+            child = (*node_num)++;
+            autopick_name_node *node_ptr = &name_nodes[child];
+            node_ptr->child = -1;
+            node_ptr->sibling = -1;
+            node_ptr->fail = 0;
+            node_ptr->output = -1;
+            node_ptr->rule = -1;
+            node_ptr->depth = name_nodes[node].depth + 1;
+            node_ptr->c = c;
+            if (node == 0) {
+                name_root_next[c] = child;
+            } else {
+                node_ptr->sibling = name_nodes[node].child;
+                name_nodes[node].child = child;
+            }
+        }
+
+        node = child;
+    }
+
+    return node;
+}
+
+/*!
+ * @brief 失敗遷移を作る / Build the failure links in breadth first order
+ * @param node_num ノード数
+ * @return なし
+ */
+static void build_name_failure_links(int node_num)
+{
+    int *queue;
+    C_MAKE(queue, node_num, int);
+    int head = 0;
+    int tail = 0;
+    for (int c = 0; c < 256; c++)
+        if (name_root_next[c] >= 0)
+            queue[tail++] = name_root_next[c];
+
+    while (head < tail) {
+        int node = queue[head++];
+        for (int child = name_nodes[node].child; child >= 0; child = name_nodes[child].sibling) {
+            byte c = name_nodes[child].c;
+            int fail = name_nodes[node].fail;
+            int next;
+            while (((next = find_name_child(fail, c)) < 0) && (fail != 0))
+                fail = name_nodes[fail].fail;
+
+            fail = (next < 0) ? 0 : next;
+            name_nodes[child].fail = fail;
+            name_nodes[child].output = ((fail != 0) && (name_nodes[fail].rule >= 0)) ? fail : name_nodes[fail].output;
+            queue[tail++] = child;
+        }
+    }
+
+    C_KILL(queue, node_num, int);
+}
+
+/*!
+ * @brief 自動拾い規則のキーワードからオートマトンを作る / Build the automaton from the keywords of autopick_list[]
+ * @return なし
+ */
+void build_autopick_name_matcher(void)
+{
+    if (name_nodes) {
+        C_KILL(name_nodes, name_node_size, autopick_name_node);
+        C_KILL(name_rule_next, name_rule_size, int);
+        C_KILL(name_rule_anchored, name_rule_size, bool);
+        C_KILL(name_rule_stamp, name_rule_size, u32b);
+    }
+
+    name_node_size = 1;
+    for (int i = 0; i < max_autopick; i++)
+        name_node_size += strlen(autopick_list[i].name);
+
+    name_rule_size = max_autopick + 1;
+    C_MAKE(name_nodes, name_node_size, autopick_name_node);
+    C_MAKE(name_rule_next, name_rule_size, int);
+    C_MAKE(name_rule_anchored, name_rule_size, bool);
+    C_MAKE(name_rule_stamp, name_rule_size, u32b);
+    name_stamp = 0;
+    for (int c = 0; c < 256; c++)
+        name_root_next[c] = -1;
+
+    name_nodes[0].child = -1;
+    name_nodes[0].sibling = -1;
+    name_nodes[0].fail = 0;
+    name_nodes[0].output = -1;
+    name_nodes[0].rule = -1;
+    name_nodes[0].depth = 0;
+    int node_num = 1;
+    for (int i = max_autopick - 1; i >= 0; i--) {
+        concptr keyword = autopick_list[i].name;
+        name_rule_anchored[i] = (keyword[0] == '^');
+        if (name_rule_anchored[i])
+            keyword++;
+
+        int node = add_name_keyword(keyword, &node_num);
+        name_rule_next[i] = name_nodes[node].rule;
+        name_nodes[node].rule = i;
+    }
+
+    build_name_failure_links(node_num);
+}
+
+/*!
+ * @brief キーワードの一致した規則に印を付ける / Mark the rules whose keyword ends at the given node
+ * @param node ノード番号
+ * @param start キーワードの開始位置
+ * @param boundary 文字の境界ならTRUEの配列
+ * @return なし
+ */
+static void mark_autopick_name_rules(int node, int start, bool *boundary)
+{
+    for (int i = name_nodes[node].rule; i >= 0; i = name_rule_next[i])
+        if (name_rule_anchored[i] ? (start == 0) : boundary[start])
+            name_rule_stamp[i] = name_stamp;
+}
+
+/*!
+ * @brief アイテム名にキーワードが一致する規則を求める / Find the rules whose keyword matches the object name
+ * @param o_name 小文字にしたアイテム名
+ * @return なし
+ * @details
+ * 結果は is_autopick_name_matched() で参照する。
+ * build_autopick_name_matcher() の後、autopick_list[] を変えずに呼ぶこと。
+ */
+void match_autopick_names(concptr o_name)
+{
+    if (++name_stamp == 0) {
+        (void)C_WIPE(name_rule_stamp, name_rule_size, u32b);
+        name_stamp = 1;
+    }
+
+    bool boundary[MAX_NLEN];
+    boundary[0] = TRUE;
+    int len = 0;
+    for (int pos = 0; (pos < MAX_NLEN) && o_name[pos]; pos++, len++) {
+        boundary[pos] = TRUE;
+#ifdef JP
+        if (iskanji(o_name[pos]) && (pos + 1 < MAX_NLEN) && o_name[pos + 1]) {
+            boundary[++pos] = FALSE;
+            len++;
+        }
+#endif
+    }
+
+    mark_autopick_name_rules(0, 0, boundary);
+    int node = 0;
+    for (int pos = 0; pos < len; pos++) {
+        byte c = (byte)o_name[pos];
+        int next;
+        while (((next = find_name_child(node, c)) < 0) && (node != 0))
+            node = name_nodes[node].fail;
+
+        node = (next < 0) ? 0 : next;
+        int out = (name_nodes[node].rule >= 0) ? node : name_nodes[node].output;
+        for (; out >= 0; out = name_nodes[out].output)
+            mark_autopick_name_rules(out, pos - name_nodes[out].depth + 1, boundary);
+    }
+}
+
+/*!
+ * @brief 直前に調べたアイテム名にキーワードが一致したかを返す / Check whether the keyword of a rule matched the last object name
+ * @param idx 自動拾いの登録番号
+ * @return 一致していたらTRUE
+ */
+bool is_autopick_name_matched(int idx) { return name_rule_stamp[idx] == name_stamp; }
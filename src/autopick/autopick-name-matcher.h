@@ -0,0 +1,8 @@
+#pragma once
+
+#include "system/angband.h"
+#include "autopick/autopick-util.h"
+
+void build_autopick_name_matcher(void);
+void match_autopick_names(concptr o_name);
+bool is_autopick_name_matched(int idx);
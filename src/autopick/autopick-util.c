@@ -1,4 +1,5 @@
 ﻿#include "autopick/autopick-util.h"
+#include "autopick/autopick-finder.h"
 #include "autopick/autopick-menu-data-table.h"
 #include "core/player-update-types.h"
 #include "core/window-redrawer.h"
@@ -99,4 +100,5 @@ void add_autopick_list(autopick_type *entry)
 
 	autopick_list[max_autopick] = *entry;
 	max_autopick++;
+	reset_autopick_index();
 }
@@ -10,6 +10,7 @@
  */
 
 #include "cmd-io/cmd-dump.h"
+#include "autopick/autopick-finder.h"
 #include "cmd-io/feeling-table.h"
 #include "core/asking-player.h"
 #include "dungeon/quest.h"
@@ -52,6 +53,7 @@ void do_cmd_pref(player_type *creature_ptr)
         return;
 
     (void)interpret_pref_file(creature_ptr, buf);
+    reset_autopick_match_cache();
 }
 
 /*
@@ -1,4 +1,5 @@
 ﻿#include "cmd-io/cmd-gameoption.h"
+#include "autopick/autopick-finder.h"
 #include "autopick/autopick.h"
 #include "cmd-io/cmd-autopick.h"
 #include "cmd-io/cmd-dump.h"
@@ -598,6 +599,7 @@ void do_cmd_options(player_type *player_ptr)
     }
 
     screen_load();
+    reset_autopick_match_cache();
     player_ptr->redraw |= (PR_EQUIPPY);
 }
 
@@ -17,6 +17,8 @@
  * @param is_autosave オートセーブ中の処理ならばTRUE
  * @return なし
  * @details
+ * オートセーブではファイルへの書き込みを別スレッドに任せ、結果は次のゲームターンで受け取る。
+ * そのため、ここでは書き込みの完了を表示しない。
  */
 void do_cmd_save_game(player_type *creature_ptr, int is_autosave)
 {
@@ -31,10 +33,12 @@ void do_cmd_save_game(player_type *creature_ptr, int is_autosave)
     term_fresh();
     (void)strcpy(creature_ptr->died_from, _("(セーブ)", "(saved)"));
     signals_ignore_tstp();
-    if (save_player(creature_ptr, SAVE_TYPE_CONTINUE_GAME))
-        prt(_("ゲームをセーブしています... 終了", "Saving game... done."), 0, 0);
-    else
+    if (!save_player(creature_ptr, is_autosave ? SAVE_TYPE_BACKGROUND : SAVE_TYPE_CONTINUE_GAME))
         prt(_("ゲームをセーブしています... 失敗！", "Saving game... failed!"), 0, 0);
+    else if (is_autosave)
+        prt(_("ゲームをセーブしています... バックグラウンドで書き込み中", "Saving game... writing in background."), 0, 0);
+    else
+        prt(_("ゲームをセーブしています... 終了", "Saving game... done."), 0, 0);
 
     signals_handle_tstp();
     term_fresh();
@@ -21,40 +21,127 @@ bool get_com_no_macros = FALSE;
 /* Determine if any macros have ever started with a given character */
 static bool macro__use[256];
 
-/* Find the macro (if any) which exactly matches the given pattern */
-int macro_find_exact(concptr pat)
+/*
+ * Node of the trie over macro patterns.
+ * Children of a node are kept in a sibling list.
+ */
+typedef struct macro_trie_node {
+    int child; /* First child, or -1 */
+    int sibling; /* Next sibling, or -1 */
+    int index; /* Macro whose pattern ends here, or -1 */
+    int first; /* Smallest macro number in the subtree, or -1 */
+    int first_below; /* Smallest macro number strictly below this node, or -1 */
+    byte c;
+} macro_trie_node;
+
+/* Trie over the patterns of the macros, node 0 is the root */
+static macro_trie_node *macro__trie = NULL;
+static int macro__trie_num = 0;
+static int macro__trie_size = 0;
+
+/* Find the child of a trie node for the given character */
+static int macro_trie_child(int node, byte c)
 {
-    if (!macro__use[(byte)(pat[0])]) {
-        return -1;
+    for (int child = macro__trie[node].child; child >= 0; child = macro__trie[child].sibling) {
+        if (macro__trie[child].c == c)
+            return child;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!streq(macro__pat[i], pat))
-            continue;
+    return -1;
+}
+
+/* Find the trie node (if any) for the given pattern */
+static int macro_trie_find(concptr pat)
+{
+    if (!macro__trie)
+        return -1;
+
+    int node = 0;
+    for (concptr s = pat; *s && (node >= 0); s++)
+        node = macro_trie_child(node, (byte)*s);
 
-        return (i);
+    return node;
+}
+
+/* Make a new trie node */
+static int macro_trie_make(byte c)
+{
+    if (macro__trie_num >= macro__trie_size) {
+        macro_trie_node *old_trie = macro__trie;
+        int old_size = macro__trie_size;
+        macro__trie_size = old_size ? old_size * 2 : 256;
+        C_MAKE(macro__trie, macro__trie_size, macro_trie_node);
+        if (old_trie) {
+            C_COPY(macro__trie, old_trie, old_size, macro_trie_node);
+            C_KILL(old_trie, old_size, macro_trie_node);
+        }
     }
 
-    return -1;
+    macro_trie_node *node_ptr = &macro__trie[macro__trie_num];
+    node_ptr->child = -1;
+    node_ptr->sibling = -1;
+    node_ptr->index = -1;
+    node_ptr->first = -1;
+    node_ptr->first_below = -1;
+    node_ptr->c = c;
+    return macro__trie_num++;
 }
 
 /*
- * Find the first macro (if any) which contains the given pattern
+ * Add the pattern of a new macro to the trie.
+ * Macro numbers only grow, so the smallest numbers only have to be set once.
  */
-int macro_find_check(concptr pat)
+static void macro_trie_add(concptr pat, int n)
+{
+    if (!macro__trie)
+        (void)macro_trie_make(0);
+
+    int node = 0;
+    for (concptr s = pat; *s; s++) {
+        if (macro__trie[node].first < 0)
+            macro__trie[node].first = n;
+
+        if (macro__trie[node].first_below < 0)
+            macro__trie[node].first_below = n;
+
+        int child = macro_trie_child(node, (byte)*s);
+        if (child < 0) {
+            child = macro_trie_make((byte)*s);
+            macro__trie[child].sibling = macro__trie[node].child;
+            macro__trie[node].child = child;
+        }
+
+        node = child;
+    }
+
+    if (macro__trie[node].first < 0)
+        macro__trie[node].first = n;
+
+    macro__trie[node].index = n;
+}
+
+/* Find the macro (if any) which exactly matches the given pattern */
+int macro_find_exact(concptr pat)
 {
     if (!macro__use[(byte)(pat[0])]) {
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat))
-            continue;
+    int node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].index;
+}
 
-        return (i);
+/*
+ * Find the first macro (if any) which contains the given pattern
+ */
+int macro_find_check(concptr pat)
+{
+    if (!macro__use[(byte)(pat[0])]) {
+        return -1;
     }
 
-    return -1;
+    int node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].first;
 }
 
 /*
@@ -66,16 +153,8 @@ int macro_find_maybe(concptr pat)
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(macro__pat[i], pat))
-            continue;
-        if (streq(macro__pat[i], pat))
-            continue;
-
-        return (i);
-    }
-
-    return -1;
+    int node = macro_trie_find(pat);
+    return (node < 0) ? -1 : macro__trie[node].first_below;
 }
 
 /*
@@ -83,22 +162,19 @@ int macro_find_maybe(concptr pat)
  */
 int macro_find_ready(concptr pat)
 {
-    int t, n = -1, s = -1;
-
     if (!macro__use[(byte)(pat[0])]) {
         return -1;
     }
 
-    for (int i = 0; i < macro__num; ++i) {
-        if (!prefix(pat, macro__pat[i]))
-            continue;
-
-        t = strlen(macro__pat[i]);
-        if ((n >= 0) && (s > t))
-            continue;
+    int n = macro__trie[0].index;
+    int node = 0;
+    for (concptr s = pat; *s; s++) {
+        node = macro_trie_child(node, (byte)*s);
+        if (node < 0)
+            break;
 
-        n = i;
-        s = t;
+        if (macro__trie[node].index >= 0)
+            n = macro__trie[node].index;
     }
 
     return (n);
@@ -129,6 +205,7 @@ errr macro_add(concptr pat, concptr act)
     } else {
         n = macro__num++;
         macro__pat[n] = string_make(pat);
+        macro_trie_add(pat, n);
     }
 
     macro__act[n] = string_make(act);
@@ -247,7 +247,7 @@ static void check_racial_target_seen(player_type *creature_ptr, it_type *it_ptr)
         term_fresh();
         term_xtra(TERM_XTRA_DELAY, it_ptr->msec);
         lite_spot(creature_ptr, it_ptr->ny[it_ptr->cur_dis], it_ptr->nx[it_ptr->cur_dis]);
-        term_fresh();
+        term_fresh_frame();
     }
 }
 
@@ -441,7 +441,7 @@ static void process_boomerang_throw(player_type *creature_ptr, it_type *it_ptr)
             term_fresh();
             term_xtra(TERM_XTRA_DELAY, it_ptr->msec);
             lite_spot(creature_ptr, it_ptr->ny[i], it_ptr->nx[i]);
-            term_fresh();
+            term_fresh_frame();
         }
     }
 
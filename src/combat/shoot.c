@@ -554,7 +554,7 @@ void exe_fire(player_type *shooter_ptr, INVENTORY_IDX item, object_type *j_ptr,
                     term_fresh();
                     term_xtra(TERM_XTRA_DELAY, msec);
                     lite_spot(shooter_ptr, ny, nx);
-                    term_fresh();
+                    term_fresh_frame();
                 }
             }
 
@@ -766,8 +766,8 @@ void exe_fire(player_type *shooter_ptr, INVENTORY_IDX item, object_type *j_ptr,
                                 if (!is_cave_empty_bold(shooter_ptr, ny, nx))
                                     break;
 
-                                shooter_ptr->current_floor_ptr->grid_array[ny][nx].m_idx = m_idx;
-                                shooter_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = 0;
+                                set_cave_monster(shooter_ptr->current_floor_ptr, ny, nx, m_idx);
+                                set_cave_monster(shooter_ptr->current_floor_ptr, oy, ox, 0);
 
                                 m_ptr->fx = nx;
                                 m_ptr->fy = ny;
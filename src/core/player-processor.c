@@ -244,8 +244,12 @@ void process_player(player_type *creature_ptr)
         update_monsters(creature_ptr, FALSE);
         handle_stuff(creature_ptr);
         move_cursor_relative(creature_ptr->y, creature_ptr->x);
-        if (fresh_before)
-            term_fresh();
+        if (fresh_before) {
+            if (need_term_fresh(creature_ptr))
+                term_fresh();
+            else
+                term_fresh_frame();
+        }
 
         pack_overflow(creature_ptr);
         if (!command_new)
@@ -207,7 +207,7 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
                         term_fresh();
                         term_xtra(TERM_XTRA_DELAY, msec);
                         lite_spot(caster_ptr, y, x);
-                        term_fresh();
+                        term_fresh_frame();
                         if (flag & (PROJECT_BEAM)) {
                             p = bolt_pict(y, x, y, x, typ);
                             a = PICT_A(p);
@@ -304,7 +304,7 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
                         term_fresh();
                         term_xtra(TERM_XTRA_DELAY, msec);
                         lite_spot(caster_ptr, y, x);
-                        term_fresh();
+                        term_fresh_frame();
                         if (flag & (PROJECT_BEAM)) {
                             p = bolt_pict(y, x, y, x, typ);
                             a = PICT_A(p);
@@ -419,7 +419,7 @@ bool project(player_type *caster_ptr, const MONSTER_IDX who, POSITION rad, POSIT
                     term_fresh();
                     term_xtra(TERM_XTRA_DELAY, msec);
                     lite_spot(caster_ptr, y, x);
-                    term_fresh();
+                    term_fresh_frame();
                     if (flag & (PROJECT_BEAM)) {
                         p = bolt_pict(y, x, y, x, typ);
                         a = PICT_A(p);
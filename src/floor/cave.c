@@ -81,11 +81,7 @@ bool player_bold(player_type *player_ptr, POSITION y, POSITION x) { return (y ==
 /*
  * Does the grid stop disintegration?
  */
-bool cave_stop_disintegration(floor_type *floor_ptr, POSITION y, POSITION x)
-{
-    return !cave_has_flag_bold(floor_ptr, y, x, FF_PROJECT)
-        && (!cave_has_flag_bold(floor_ptr, y, x, FF_HURT_DISI) || cave_has_flag_bold(floor_ptr, y, x, FF_PERMANENT));
-}
+bool cave_stop_disintegration(floor_type *floor_ptr, POSITION y, POSITION x) { return cave_pass_bold(floor_ptr, y, x, PASS_STOP_DISI); }
 
 /*
  * @brief 指定のマスが光を通すか(LOSフラグを持つか)を返す。 / Aux function -- see below
@@ -94,7 +90,7 @@ bool cave_stop_disintegration(floor_type *floor_ptr, POSITION y, POSITION x)
  * @param x 指定X座標
  * @return 光を通すならばtrueを返す。
  */
-bool cave_los_bold(floor_type *floor_ptr, POSITION y, POSITION x) { return feat_supports_los(floor_ptr->grid_array[y][x].feat); }
+bool cave_los_bold(floor_type *floor_ptr, POSITION y, POSITION x) { return cave_pass_bold(floor_ptr, y, x, PASS_LOS); }
 
 /*
  * Determine if a "feature" supports "los"
@@ -105,6 +101,78 @@ bool cave_los_grid(grid_type *grid_ptr) { return feat_supports_los(grid_ptr->fea
 
 bool cave_has_flag_grid(grid_type *grid_ptr, int feature_flags) { return has_flag(f_info[grid_ptr->feat].flags, feature_flags); }
 
+/*!
+ * @brief 地形の通過特性を求める / Extract the traversal class of a feature
+ * @param f_idx 地形ID
+ * @return 通過特性 (PASS_*)
+ */
+BIT_FLAGS8 feat_pass_class(FEAT_IDX f_idx)
+{
+    feature_type *f_ptr = &f_info[f_idx];
+    BIT_FLAGS8 pass = 0;
+    if (has_flag(f_ptr->flags, FF_LOS))
+        pass |= PASS_LOS;
+    if (has_flag(f_ptr->flags, FF_PROJECT))
+        pass |= PASS_PROJECT;
+    if (has_flag(f_ptr->flags, FF_MOVE))
+        pass |= PASS_MOVE;
+    if ((has_flag(f_ptr->flags, FF_OPEN) || has_flag(f_ptr->flags, FF_BASH)) && !has_flag(f_ptr->flags, FF_MOVE))
+        pass |= PASS_DOOR;
+    if (has_flag(f_ptr->flags, FF_WALL))
+        pass |= PASS_WALL;
+    if (!has_flag(f_ptr->flags, FF_PROJECT) && (!has_flag(f_ptr->flags, FF_HURT_DISI) || has_flag(f_ptr->flags, FF_PERMANENT)))
+        pass |= PASS_STOP_DISI;
+
+    return pass;
+}
+
+/*!
+ * @brief 指定マスの通過特性を地形に合わせる / Update the traversal class of a grid
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y 指定Y座標
+ * @param x 指定X座標
+ * @return なし
+ */
+void update_pass_bold(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    floor_ptr->pass_array[y][x] = feat_pass_class(floor_ptr->grid_array[y][x].feat);
+    floor_ptr->pass_version++;
+}
+
+/*!
+ * @brief フロア全体の通過特性を作り直す / Rebuild the traversal class of the whole floor
+ * @param floor_ptr フロアへの参照ポインタ
+ * @return なし
+ * @details
+ * フロア生成中は地形が直接書き換えられるため、生成が完了した時点で呼ぶこと。
+ */
+void update_pass_all(floor_type *floor_ptr)
+{
+    for (POSITION y = 0; y < floor_ptr->height; y++) {
+        for (POSITION x = 0; x < floor_ptr->width; x++) {
+            update_pass_bold(floor_ptr, y, x);
+        }
+    }
+}
+
+/*!
+ * @brief 指定マスが通過特性を持つかを返す / Check the traversal class of a grid
+ * @param floor_ptr フロアへの参照ポインタ
+ * @param y 指定Y座標
+ * @param x 指定X座標
+ * @param pass 調べる通過特性 (PASS_*)
+ * @return いずれかの特性を持つならばTRUE
+ * @details
+ * フロア生成中は pass_array が同期していないので地形から直接求める。
+ */
+bool cave_pass_bold(floor_type *floor_ptr, POSITION y, POSITION x, BIT_FLAGS8 pass)
+{
+    if (!current_world_ptr->character_dungeon)
+        return (feat_pass_class(floor_ptr->grid_array[y][x].feat) & pass) != 0;
+
+    return (floor_ptr->pass_array[y][x] & pass) != 0;
+}
+
 /*
  * Determine if a "legal" grid is a "clean" floor grid
  * Determine if terrain-change spells are allowed in a grid.
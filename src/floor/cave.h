@@ -2,6 +2,16 @@
 
 #include "system/angband.h"
 
+/* 地形の通過特性 (floor_type::pass_array) / Traversal class of the grids */
+typedef enum cave_pass_type {
+    PASS_LOS = 0x01, /*!< 視線を通す (FF_LOS) / Supports "los" */
+    PASS_PROJECT = 0x02, /*!< 射線を通す (FF_PROJECT) / Supports "projection" */
+    PASS_MOVE = 0x04, /*!< 移動できる (FF_MOVE) / Can be entered */
+    PASS_DOOR = 0x08, /*!< 閉じたドア / Closed door */
+    PASS_WALL = 0x10, /*!< 壁 (FF_WALL) / Wall */
+    PASS_STOP_DISI = 0x20, /*!< 分解を止める / Stops disintegration */
+} cave_pass_type;
+
 typedef enum feature_flag_type feature_flag_type;
 typedef struct grid_type grid_type;
 bool in_bounds(floor_type *floor_ptr, POSITION y, POSITION x);
@@ -17,6 +27,10 @@ bool cave_los_bold(floor_type *floor_ptr, POSITION y, POSITION x);
 bool feat_supports_los(FEAT_IDX f_idx);
 bool cave_los_grid(grid_type *grid_ptr);
 bool cave_has_flag_grid(grid_type *grid_ptr, int feature_flags);
+BIT_FLAGS8 feat_pass_class(FEAT_IDX f_idx);
+void update_pass_bold(floor_type *floor_ptr, POSITION y, POSITION x);
+void update_pass_all(floor_type *floor_ptr);
+bool cave_pass_bold(floor_type *floor_ptr, POSITION y, POSITION x, BIT_FLAGS8 pass);
 bool cave_clean_bold(floor_type *floor_ptr, POSITION y, POSITION x);
 bool cave_drop_bold(floor_type *floor_ptr, POSITION y, POSITION x);
 bool pattern_tile(floor_type *floor_ptr, POSITION y, POSITION x);
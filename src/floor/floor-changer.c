@@ -4,6 +4,7 @@
 #include "dungeon/quest-monster-placer.h"
 #include "dungeon/quest.h"
 #include "effect/effect-characteristics.h"
+#include "floor/cave.h"
 #include "floor/floor-generator.h"
 #include "floor/floor-mode-changer.h"
 #include "floor/floor-object.h"
@@ -97,7 +98,7 @@ static MONSTER_IDX decide_pet_index(player_type *master_ptr, const int current_m
 static void set_pet_params(player_type *master_ptr, monster_race **r_ptr, const int current_monster, MONSTER_IDX m_idx, const POSITION cy, const POSITION cx)
 {
     monster_type *m_ptr = &master_ptr->current_floor_ptr->m_list[m_idx];
-    master_ptr->current_floor_ptr->grid_array[cy][cx].m_idx = m_idx;
+    set_cave_monster(master_ptr->current_floor_ptr, cy, cx, m_idx);
     m_ptr->r_idx = party_mon[current_monster].r_idx;
     *m_ptr = party_mon[current_monster];
     *r_ptr = real_r_ptr(m_ptr);
@@ -384,6 +385,7 @@ void change_floor(player_type *creature_ptr)
     forget_travel_flow(creature_ptr->current_floor_ptr);
     update_unique_artifact(creature_ptr->current_floor_ptr, new_floor_id);
     creature_ptr->floor_id = new_floor_id;
+    update_pass_all(creature_ptr->current_floor_ptr);
     current_world_ptr->character_dungeon = TRUE;
     if (creature_ptr->pseikaku == PERSONALITY_MUNCHKIN)
         wiz_lite(creature_ptr, (bool)(creature_ptr->pclass == CLASS_NINJA));
@@ -342,20 +342,15 @@ void clear_cave(player_type *player_ptr)
         floor_ptr->mproc_max[i] = 0;
 
     precalc_cur_num_of_pet(player_ptr);
-    for (POSITION y = 0; y < MAX_HGT; y++) {
-        for (POSITION x = 0; x < MAX_WID; x++) {
-            grid_type *g_ptr = &floor_ptr->grid_array[y][x];
-            g_ptr->info = 0;
-            g_ptr->feat = 0;
-            g_ptr->o_idx = 0;
-            g_ptr->m_idx = 0;
-            g_ptr->special = 0;
-            g_ptr->mimic = 0;
-            g_ptr->cost = 0;
-            g_ptr->dist = 0;
-            g_ptr->when = 0;
-        }
-    }
+    (void)C_WIPE(floor_ptr->grid_array[0], MAX_HGT * MAX_WID, grid_type);
+    (void)C_WIPE(floor_ptr->m_bucket_num, sizeof(floor_ptr->m_bucket_num), byte);
+    (void)C_WIPE(floor_ptr->cost_array[0], MAX_HGT * MAX_WID, byte);
+    (void)C_WIPE(floor_ptr->dist_array[0], MAX_HGT * MAX_WID, byte);
+    (void)C_WIPE(floor_ptr->when_array[0], MAX_HGT * MAX_WID, byte);
+    (void)C_WIPE(floor_ptr->pass_array[0], MAX_HGT * MAX_WID, BIT_FLAGS8);
+    floor_ptr->pass_version++;
+
+    reset_flow();
 
     floor_ptr->base_level = floor_ptr->dun_level;
     floor_ptr->monster_level = floor_ptr->base_level;
@@ -11,6 +11,7 @@
 #include "game-option/birth-options.h"
 #include "game-option/play-record-options.h"
 #include "grid/feature.h"
+#include "grid/grid.h"
 #include "inventory/inventory-slot-types.h"
 #include "io/write-diary.h"
 #include "mind/mind-mirror-master.h"
@@ -231,8 +232,8 @@ static void get_out_monster(player_type *protected_ptr)
             continue;
 
         m_ptr = &floor_ptr->m_list[m_idx];
-        floor_ptr->grid_array[oy][ox].m_idx = 0;
-        floor_ptr->grid_array[ny][nx].m_idx = m_idx;
+        set_cave_monster(floor_ptr, oy, ox, 0);
+        set_cave_monster(floor_ptr, ny, nx, m_idx);
         m_ptr->fy = ny;
         m_ptr->fx = nx;
         return;
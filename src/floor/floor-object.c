@@ -60,6 +60,7 @@ static errr get_obj_num_prep(void)
         }
     }
 
+    reset_obj_num_table();
     return 0;
 }
 
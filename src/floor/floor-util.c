@@ -61,8 +61,8 @@ void update_smell(floor_type *floor_ptr, player_type *subject_ptr)
     if (++scent_when == 254) {
         for (POSITION y = 0; y < floor_ptr->height; y++) {
             for (POSITION x = 0; x < floor_ptr->width; x++) {
-                int w = floor_ptr->grid_array[y][x].when;
-                floor_ptr->grid_array[y][x].when = (w > 128) ? (w - 128) : 0;
+                int w = floor_ptr->when_array[y][x];
+                floor_ptr->when_array[y][x] = (w > 128) ? (w - 128) : 0;
             }
         }
 
@@ -71,21 +71,19 @@ void update_smell(floor_type *floor_ptr, player_type *subject_ptr)
 
     for (POSITION i = 0; i < 5; i++) {
         for (POSITION j = 0; j < 5; j++) {
-            grid_type *g_ptr;
             POSITION y = i + subject_ptr->y - 2;
             POSITION x = j + subject_ptr->x - 2;
             if (!in_bounds(floor_ptr, y, x))
                 continue;
 
-            g_ptr = &floor_ptr->grid_array[y][x];
-            if (!cave_has_flag_grid(g_ptr, FF_MOVE) && !is_closed_door(subject_ptr, g_ptr->feat))
+            if (!cave_pass_bold(floor_ptr, y, x, PASS_MOVE | PASS_DOOR))
                 continue;
             if (!player_has_los_bold(subject_ptr, y, x))
                 continue;
             if (scent_adjust[i][j] == -1)
                 continue;
 
-            g_ptr->when = scent_when + scent_adjust[i][j];
+            floor_ptr->when_array[y][x] = scent_when + scent_adjust[i][j];
         }
     }
 }
@@ -96,12 +94,12 @@ void update_smell(floor_type *floor_ptr, player_type *subject_ptr)
 void forget_flow(floor_type *floor_ptr)
 {
     for (POSITION y = 0; y < floor_ptr->height; y++) {
-        for (POSITION x = 0; x < floor_ptr->width; x++) {
-            floor_ptr->grid_array[y][x].dist = 0;
-            floor_ptr->grid_array[y][x].cost = 0;
-            floor_ptr->grid_array[y][x].when = 0;
-        }
+        (void)C_WIPE(floor_ptr->dist_array[y], floor_ptr->width, byte);
+        (void)C_WIPE(floor_ptr->cost_array[y], floor_ptr->width, byte);
+        (void)C_WIPE(floor_ptr->when_array[y], floor_ptr->width, byte);
     }
+
+    reset_flow();
 }
 
 /*!
@@ -194,9 +194,11 @@ void cave_set_feat(player_type *player_ptr, POSITION y, POSITION x, FEAT_IDX fea
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     grid_type *g_ptr = &floor_ptr->grid_array[y][x];
     feature_type *f_ptr = &f_info[feat];
+    notice_flow_feat(y, x);
     if (!current_world_ptr->character_dungeon) {
         g_ptr->mimic = 0;
         g_ptr->feat = feat;
+        update_pass_bold(floor_ptr, y, x);
         if (has_flag(f_ptr->flags, FF_GLOW) && !(d_info[floor_ptr->dungeon_idx].flags1 & DF1_DARKNESS)) {
             for (DIRECTION i = 0; i < 9; i++) {
                 POSITION yy = y + ddy_ddd[i];
@@ -216,6 +218,7 @@ void cave_set_feat(player_type *player_ptr, POSITION y, POSITION x, FEAT_IDX fea
 
     g_ptr->mimic = 0;
     g_ptr->feat = feat;
+    update_pass_bold(floor_ptr, y, x);
     g_ptr->info &= ~(CAVE_OBJECT);
     if (old_mirror && (d_info[floor_ptr->dungeon_idx].flags1 & DF1_DARKNESS)) {
         g_ptr->info &= ~(CAVE_GLOW);
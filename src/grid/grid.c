@@ -473,6 +473,8 @@ void note_spot(player_type *player_ptr, POSITION y, POSITION x)
     if (player_ptr->blind)
         return;
 
+    note_map_overview_grid(player_ptr->current_floor_ptr, y, x);
+
     /* Analyze non-torch-lit grids */
     if (!(g_ptr->info & (CAVE_LITE | CAVE_MNLT))) {
         /* Require line of sight to the grid */
@@ -546,6 +548,8 @@ void note_spot(player_type *player_ptr, POSITION y, POSITION x)
  */
 void lite_spot(player_type *player_ptr, POSITION y, POSITION x)
 {
+    note_map_overview_grid(player_ptr->current_floor_ptr, y, x);
+
     /* Redraw if on screen */
     if (panel_contains(y, x) && in_bounds2(player_ptr->current_floor_ptr, y, x)) {
         TERM_COLOR a;
@@ -787,6 +791,36 @@ void lite_spot(player_type *player_ptr, POSITION y, POSITION x)
 static POSITION flow_x = 0;
 static POSITION flow_y = 0;
 
+/*
+ * The flow information computed from (flow_y, flow_x) is still exact,
+ * i.e. no terrain within MONSTER_FLOW_DEPTH of the way-point has changed
+ * since then.
+ */
+static bool flow_exact = FALSE;
+
+/*!
+ * @brief フロー情報が全て消去されたことを通知する / Notice that all of the flow information has been wiped
+ * @return なし
+ */
+void reset_flow(void)
+{
+    flow_exact = FALSE;
+}
+
+/*!
+ * @brief 地形の変化をフロー情報に通知する / Notice a change of the terrain to the flow information
+ * @param y 地形が変わったマスのY座標
+ * @param x 地形が変わったマスのX座標
+ * @return なし
+ * @details
+ * 前回のフロー起点から MONSTER_FLOW_DEPTH より遠いマスは結果に影響しない。
+ */
+void notice_flow_feat(POSITION y, POSITION x)
+{
+    if ((ABS(y - flow_y) <= MONSTER_FLOW_DEPTH) && (ABS(x - flow_x) <= MONSTER_FLOW_DEPTH))
+        flow_exact = FALSE;
+}
+
 /*
  * Hack -- fill in the "cost" field of every grid that the player
  * can "reach" with the number of steps needed to reach that grid.
@@ -799,6 +833,11 @@ static POSITION flow_y = 0;
  *
  * We do not need a priority queue because the cost from grid
  * to grid is always "one" and we process them in order.
+ *
+ * Every stamped grid lies within MONSTER_FLOW_DEPTH of the way-point,
+ * so only that square has to be erased before the next pass, and
+ * nothing has to be done at all while the player stays on the
+ * way-point and the terrain around it is unchanged.
  */
 void update_flow(player_type *subject_ptr)
 {
@@ -806,29 +845,38 @@ void update_flow(player_type *subject_ptr)
     DIRECTION d;
     int flow_head_grid = 1;
     int flow_tail_grid = 0;
+    floor_type *floor_ptr = subject_ptr->current_floor_ptr;
+    bool pass_synced = current_world_ptr->character_dungeon;
 
     /* Paranoia -- make sure the array is empty */
     if (tmp_pos.n)
         return;
 
     /* The last way-point is on the map */
-    if (subject_ptr->running && in_bounds(subject_ptr->current_floor_ptr, flow_y, flow_x)) {
+    if (subject_ptr->running && in_bounds(floor_ptr, flow_y, flow_x)) {
         /* The way point is in sight - do not update.  (Speedup) */
-        if (subject_ptr->current_floor_ptr->grid_array[flow_y][flow_x].info & CAVE_VIEW)
+        if (floor_ptr->grid_array[flow_y][flow_x].info & CAVE_VIEW)
             return;
     }
 
-    /* Erase all of the current flow information */
-    for (y = 0; y < subject_ptr->current_floor_ptr->height; y++) {
-        for (x = 0; x < subject_ptr->current_floor_ptr->width; x++) {
-            subject_ptr->current_floor_ptr->grid_array[y][x].cost = 0;
-            subject_ptr->current_floor_ptr->grid_array[y][x].dist = 0;
-        }
+    /* Nothing has changed since the last pass */
+    if (flow_exact && player_bold(subject_ptr, flow_y, flow_x))
+        return;
+
+    /* Erase the flow information around the last way-point */
+    POSITION y1 = MAX(flow_y - MONSTER_FLOW_DEPTH, 0);
+    POSITION y2 = MIN(flow_y + MONSTER_FLOW_DEPTH, floor_ptr->height - 1);
+    POSITION x1 = MAX(flow_x - MONSTER_FLOW_DEPTH, 0);
+    POSITION x2 = MIN(flow_x + MONSTER_FLOW_DEPTH, floor_ptr->width - 1);
+    for (y = y1; y <= y2; y++) {
+        (void)C_WIPE(&floor_ptr->cost_array[y][x1], x2 - x1 + 1, byte);
+        (void)C_WIPE(&floor_ptr->dist_array[y][x1], x2 - x1 + 1, byte);
     }
 
     /* Save player position */
     flow_y = subject_ptr->y;
     flow_x = subject_ptr->x;
+    flow_exact = TRUE;
 
     /* Add the player's grid to the queue */
     tmp_pos.y[0] = subject_ptr->y;
@@ -849,9 +897,11 @@ void update_flow(player_type *subject_ptr)
         /* Add the "children" */
         for (d = 0; d < 8; d++) {
             int old_head = flow_head_grid;
-            byte m = subject_ptr->current_floor_ptr->grid_array[ty][tx].cost + 1;
-            byte n = subject_ptr->current_floor_ptr->grid_array[ty][tx].dist + 1;
-            grid_type *g_ptr;
+            byte m = floor_ptr->cost_array[ty][tx] + 1;
+            byte n = floor_ptr->dist_array[ty][tx] + 1;
+            BIT_FLAGS8 pass;
+            byte *cost_ptr;
+            byte *dist_ptr;
 
             /* Child location */
             y = ty + ddy_ddd[d];
@@ -861,24 +911,26 @@ void update_flow(player_type *subject_ptr)
             if (player_bold(subject_ptr, y, x))
                 continue;
 
-            g_ptr = &subject_ptr->current_floor_ptr->grid_array[y][x];
+            pass = pass_synced ? floor_ptr->pass_array[y][x] : feat_pass_class(floor_ptr->grid_array[y][x].feat);
+            cost_ptr = &floor_ptr->cost_array[y][x];
+            dist_ptr = &floor_ptr->dist_array[y][x];
 
-            if (is_closed_door(subject_ptr, g_ptr->feat))
+            if (pass & PASS_DOOR)
                 m += 3;
 
             /* Ignore "pre-stamped" entries */
-            if (g_ptr->dist != 0 && g_ptr->dist <= n && g_ptr->cost <= m)
+            if (*dist_ptr != 0 && *dist_ptr <= n && *cost_ptr <= m)
                 continue;
 
             /* Ignore "walls" and "rubble" */
-            if (!cave_has_flag_grid(g_ptr, FF_MOVE) && !is_closed_door(subject_ptr, g_ptr->feat))
+            if (!(pass & (PASS_MOVE | PASS_DOOR)))
                 continue;
 
             /* Save the flow cost */
-            if (g_ptr->cost == 0 || g_ptr->cost > m)
-                g_ptr->cost = m;
-            if (g_ptr->dist == 0 || g_ptr->dist > n)
-                g_ptr->dist = n;
+            if (*cost_ptr == 0 || *cost_ptr > m)
+                *cost_ptr = m;
+            if (*dist_ptr == 0 || *dist_ptr > n)
+                *dist_ptr = n;
 
             /* Hack -- limit flow depth */
             if (n == MONSTER_FLOW_DEPTH)
@@ -1328,6 +1380,30 @@ void place_bold(player_type *player_ptr, POSITION y, POSITION x, grid_bold_type
 
 void set_cave_feat(floor_type *floor_ptr, POSITION y, POSITION x, FEAT_IDX feature_idx) { floor_ptr->grid_array[y][x].feat = feature_idx; }
 
+/*!
+ * @brief グリッドにいるモンスターを設定する / Set the monster on a grid
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y 設定するグリッドのY座標
+ * @param x 設定するグリッドのX座標
+ * @param m_idx モンスターID (0ならば空にする)
+ * @return なし
+ * @details
+ * 区画ごとのモンスター数 floor_type::m_bucket_num を合わせて更新するため、
+ * grid_type::m_idx は必ずこの関数を通して書き換えること。
+ */
+void set_cave_monster(floor_type *floor_ptr, POSITION y, POSITION x, MONSTER_IDX m_idx)
+{
+    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+    byte *num_ptr = &floor_ptr->m_bucket_num[y / MONSTER_BUCKET_SIZE][x / MONSTER_BUCKET_SIZE];
+    if (g_ptr->m_idx)
+        (*num_ptr)--;
+
+    if (m_idx)
+        (*num_ptr)++;
+
+    g_ptr->m_idx = m_idx;
+}
+
 /*!
  * todo intをenumに変更する
  */
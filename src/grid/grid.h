@@ -41,7 +41,9 @@
   * create the singly linked list of objects.  If "o_idx" is zero
   * then there are no objects in the grid.
   *
-  * Note the special fields for the "MONSTER_FLOW" code.
+  * The fields for the "MONSTER_FLOW" code (cost, dist and when) are
+  * kept in separate planes of floor_type (cost_array etc.), so that the
+  * sweeps over them do not have to drag the rest of the grid along.
   */
 
 typedef struct grid_type {
@@ -59,10 +61,6 @@ typedef struct grid_type {
 	s16b special;
 
 	FEAT_IDX mimic;		/* Feature to mimic */
-
-	byte cost;		/* Hack -- cost of flowing */
-	byte dist;		/* Hack -- distance from player */
-	byte when;		/* Hack -- when cost was computed */
 } grid_type;
 
 /*  A structure type for terrain template of saving dungeon floor */
@@ -72,6 +70,7 @@ typedef struct grid_template_type {
 	FEAT_IDX mimic;
 	s16b special;
 	u16b occurrence;
+	u16b index; /* Order of first appearance while collecting templates */
 } grid_template_type;
 
 /*!
@@ -168,6 +167,8 @@ extern bool no_lite(player_type *creature_ptr);
 extern void print_rel(player_type *subject_ptr, SYMBOL_CODE c, TERM_COLOR a, POSITION y, POSITION x);
 extern void note_spot(player_type *player_ptr, POSITION y, POSITION x);
 extern void lite_spot(player_type *player_ptr, POSITION y, POSITION x);
+extern void reset_flow(void);
+extern void notice_flow_feat(POSITION y, POSITION x);
 extern void update_flow(player_type *subject_ptr);
 extern FEAT_IDX feat_state(player_type *player_ptr, FEAT_IDX feat, int action);
 extern void cave_alter_feat(player_type *player_ptr, POSITION y, POSITION x, int action);
@@ -197,6 +198,7 @@ bool darkened_grid(player_type *player_ptr, grid_type *g_ptr);
 void delete_monster(player_type *player_ptr, POSITION y, POSITION x);
 void place_bold(player_type *player_ptr, POSITION y, POSITION x, grid_bold_type gh_type);
 void set_cave_feat(floor_type *floor_ptr, POSITION y, POSITION x, FEAT_IDX feature_idx);
+void set_cave_monster(floor_type *floor_ptr, POSITION y, POSITION x, MONSTER_IDX m_idx);
 void add_cave_info(floor_type *floor_ptr, POSITION y, POSITION x, int cave_mask);
 FEAT_IDX get_feat_mimic(grid_type *g_ptr);
 
@@ -238,6 +238,7 @@ void place_trap(player_type *trapped_ptr, POSITION y, POSITION x)
     /* Place an invisible trap */
     g_ptr->mimic = g_ptr->feat;
     g_ptr->feat = choose_random_trap(trapped_ptr);
+    update_pass_bold(floor_ptr, y, x);
 }
 
 /*!
@@ -1,5 +1,6 @@
 ﻿#include "load/dungeon-loader.h"
 #include "dungeon/quest.h"
+#include "floor/cave.h"
 #include "floor/floor-save-util.h"
 #include "floor/floor-save.h"
 #include "load/angband-version-comparer.h"
@@ -116,6 +117,7 @@ static errr rd_dungeon(player_type *player_ptr)
         break;
     }
 
+    update_pass_all(player_ptr->current_floor_ptr);
     current_world_ptr->character_dungeon = TRUE;
     return err;
 }
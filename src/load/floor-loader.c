@@ -208,7 +208,6 @@ errr rd_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
         return 161;
 
     for (int i = 1; i < limit; i++) {
-        grid_type *g_ptr;
         MONSTER_IDX m_idx;
         monster_type *m_ptr;
         m_idx = m_pop(floor_ptr);
@@ -217,8 +216,7 @@ errr rd_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
 
         m_ptr = &floor_ptr->m_list[m_idx];
         rd_monster(player_ptr, m_ptr);
-        g_ptr = &floor_ptr->grid_array[m_ptr->fy][m_ptr->fx];
-        g_ptr->m_idx = m_idx;
+        set_cave_monster(floor_ptr, m_ptr->fy, m_ptr->fx, m_idx);
         real_r_ptr(m_ptr)->cur_num++;
     }
 
@@ -303,6 +301,7 @@ bool load_floor(player_type *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mod
     byte old_h_ver_patch = 0;
     byte old_h_ver_extra = 0;
     if (mode & SLF_SECOND) {
+        unread_savefile();
         old_fff = loading_savefile;
         old_xor_byte = load_xor_byte;
         old_v_check = v_check;
@@ -329,6 +328,7 @@ bool load_floor(player_type *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mod
         if (ferror(loading_savefile))
             is_save_successful = FALSE;
 
+        unread_savefile();
         angband_fclose(loading_savefile);
         safe_setuid_grab(player_ptr);
         if (!(mode & SLF_NO_KILL))
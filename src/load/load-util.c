@@ -1,4 +1,5 @@
 ﻿#include "load/load-util.h"
+#include "save/save-util.h"
 #include "term/screen-processor.h"
 #ifdef JP
 #include "locale/japanese.h"
@@ -18,6 +19,11 @@ u32b x_check = 0L; // Simple "checksum" on the encoded bytes.
  */
 byte kanji_code = 0;
 
+/* Bytes read ahead from loading_savefile */
+static byte load_buffer[SAVEFILE_BUFFER_SIZE];
+static size_t load_buffer_pos = 0;
+static size_t load_buffer_len = 0;
+
 /*!
  * @brief ゲームスクリーンにメッセージを表示する / Hack -- Show information on the screen, one line at a time.
  * @param msg 表示文字列
@@ -35,6 +41,21 @@ void load_note(concptr msg)
     term_fresh();
 }
 
+/*!
+ * @brief 先読みしたが使わなかったバイト列をファイルに戻す / Give the unread part of the buffer back to the savefile
+ * @return なし
+ * @details
+ * loading_savefile を閉じたり差し替えたりする前に必ず呼ぶこと。
+ */
+void unread_savefile(void)
+{
+    if (load_buffer_pos < load_buffer_len)
+        (void)fseek(loading_savefile, -(long)(load_buffer_len - load_buffer_pos), SEEK_CUR);
+
+    load_buffer_pos = 0;
+    load_buffer_len = 0;
+}
+
 /*!
  * @brief ロードファイルポインタから1バイトを読み込む
  * @return 読み込んだバイト値
@@ -44,7 +65,13 @@ void load_note(concptr msg)
  */
 byte sf_get(void)
 {
-    byte c = getc(loading_savefile) & 0xFF;
+    if (load_buffer_pos == load_buffer_len) {
+        load_buffer_pos = 0;
+        load_buffer_len = fread(load_buffer, 1, SAVEFILE_BUFFER_SIZE, loading_savefile);
+    }
+
+    /* Past the end of file, behave like getc() (EOF & 0xFF) */
+    byte c = (load_buffer_pos < load_buffer_len) ? load_buffer[load_buffer_pos++] : 0xFF;
     byte v = c ^ load_xor_byte;
     load_xor_byte = c;
 
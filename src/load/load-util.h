@@ -9,6 +9,7 @@ extern u32b x_check;
 extern byte kanji_code;
 
 void load_note(concptr msg);
+void unread_savefile(void);
 byte sf_get(void);
 void rd_byte(byte *ip);
 void rd_u16b(u16b *ip);
@@ -766,9 +766,7 @@ errr rd_dungeon_old(player_type *player_ptr)
 
         m_ptr = &floor_ptr->m_list[m_idx];
         rd_monster(player_ptr, m_ptr);
-        grid_type *g_ptr;
-        g_ptr = &floor_ptr->grid_array[m_ptr->fy][m_ptr->fx];
-        g_ptr->m_idx = m_idx;
+        set_cave_monster(floor_ptr, m_ptr->fy, m_ptr->fx, m_idx);
         real_r_ptr(m_ptr)->cur_num++;
     }
 
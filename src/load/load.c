@@ -253,6 +253,7 @@ static errr rd_savefile(player_type *player_ptr)
     if (ferror(loading_savefile))
         err = -1;
 
+    unread_savefile();
     angband_fclose(loading_savefile);
     return err;
 }
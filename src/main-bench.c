@@ -0,0 +1,548 @@
+﻿/*!
+ * @brief ヘッドレス・ターン処理ベンチマーク / Headless, deterministic turn-throughput benchmark
+ * @date 2026/10/16
+ * @details
+ * セーブファイルを読み込み、端末を接続しないまま固定シードで N ゲームターン分の
+ * プレイヤー/モンスター/ワールド処理を回し、ターン毎秒とサブシステム毎の処理時間、
+ * 最大常駐メモリ量を標準出力に報告する。
+ * 最後にフロアとプレイヤーの状態のダイジェストを表示するので、
+ * 処理の高速化で結果が変わっていないかを実行結果の比較で確かめられる。
+ * プレイヤーは休憩し続け (邪魔された場合は捜索で手番を消費する)、HPの全快と無敵状態が毎ターン維持される。
+ * 入力を要求された場合はESCとEnterが交互に押されたものとして扱う。
+ * セーブファイルへの書き戻しは行わない。
+ *
+ * Usage: hengband-bench [-t<turns>] [-s<seed>] [-l<depth>] <savefile>
+ */
+
+#include "autopick/autopick-pref-processor.h"
+#include "cmd-io/cmd-gameoption.h"
+#include "core/hp-mp-regenerator.h"
+#include "core/object-compressor.h"
+#include "core/player-processor.h"
+#include "core/player-update-types.h"
+#include "core/stuff-handler.h"
+#include "core/turn-compensator.h"
+#include "core/visuals-reseter.h"
+#include "dungeon/dungeon.h"
+#include "flavor/object-flavor.h"
+#include "floor/floor-changer.h"
+#include "floor/floor-leaver.h"
+#include "floor/floor-mode-changer.h"
+#include "floor/floor-save.h"
+#include "floor/floor-util.h"
+#include "floor/wild.h"
+#include "game-option/input-options.h"
+#include "game-option/special-options.h"
+#include "grid/grid.h"
+#include "info-reader/fixed-map-parser.h"
+#include "io/cursor.h"
+#include "io/files-util.h"
+#include "io/input-key-requester.h"
+#include "load/load.h"
+#include "main/angband-initializer.h"
+#include "monster-floor/monster-remover.h"
+#include "monster/monster-compaction.h"
+#include "monster/monster-processor.h"
+#include "monster/monster-status.h"
+#include "player/attack-defense-types.h"
+#include "player/player-status.h"
+#include "player/process-name.h"
+#include "status/action-setter.h"
+#include "system/angband.h"
+#include "system/floor-type-definition.h"
+#include "system/monster-type-definition.h"
+#include "system/object-type-definition.h"
+#include "system/system-variables.h"
+#include "target/target-checker.h"
+#include "term/gameterm.h"
+#include "term/term-color-types.h"
+#include "term/z-rand.h"
+#include "util/angband-files.h"
+#include "util/int-char-converter.h"
+#include "util/string-processor.h"
+#include "view/display-messages.h"
+#include "world/world-turn-processor.h"
+#include "world/world.h"
+
+#include <sys/resource.h>
+#include <time.h>
+
+#define BENCH_DEFAULT_TURNS 10000L /*!< 既定の計測ゲームターン数 */
+#define BENCH_DEFAULT_SEED 0x5EEDUL /*!< 既定の乱数シード */
+#define BENCH_REST_COUNT 9999 /*!< 休憩コマンドの再設定時に与える休憩回数 */
+#define BENCH_INVULN_TURNS 10 /*!< 毎ターン与え直す無敵状態の残りターン数 */
+
+/*!
+ * @brief サブシステム毎の計測区分 / Subsystems measured by the benchmark
+ */
+typedef enum bench_section_type {
+    BENCH_PLAYER = 0, /*!< process_player() / process_upkeep_with_speed() */
+    BENCH_MONSTERS = 1, /*!< process_monsters() */
+    BENCH_WORLD = 2, /*!< process_world() */
+    BENCH_STUFF = 3, /*!< handle_stuff() */
+    BENCH_COMPACT = 4, /*!< compact_monsters() / compact_objects() */
+    MAX_BENCH_SECTION = 5,
+} bench_section_type;
+
+static concptr bench_section_names[MAX_BENCH_SECTION] = {
+    "player",
+    "monsters",
+    "world",
+    "stuff",
+    "compact",
+};
+
+/*!
+ * @brief ベンチマーク結果 / Benchmark result
+ */
+typedef struct bench_result_type {
+    s32b turns; /*!< 実際に処理したゲームターン数 */
+    double elapsed; /*!< 全体の経過時間(秒) */
+    double section[MAX_BENCH_SECTION]; /*!< サブシステム毎の経過時間(秒) */
+    concptr stop_reason; /*!< 指定ターン数より前に止まった理由 (NULLなら完走) */
+} bench_result_type;
+
+static term_type term_bench_body;
+
+/*!
+ * @brief 単調増加時計の現在値を秒で返す / Read the monotonic clock in seconds
+ * @return 現在時刻(秒)
+ */
+static double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1.0e9;
+}
+
+/*
+ * Nothing is ever displayed, but the z-term bookkeeping still runs.
+ */
+static errr term_text_bench(TERM_LEN x, TERM_LEN y, int n, TERM_COLOR a, concptr s)
+{
+    (void)x;
+    (void)y;
+    (void)n;
+    (void)a;
+    (void)s;
+    return 0;
+}
+
+static errr term_wipe_bench(TERM_LEN x, TERM_LEN y, int n)
+{
+    (void)x;
+    (void)y;
+    (void)n;
+    return 0;
+}
+
+static errr term_curs_bench(TERM_LEN x, TERM_LEN y)
+{
+    (void)x;
+    (void)y;
+    return 0;
+}
+
+/*
+ * Any blocking request for input is answered alternately with an escape
+ * and a return, so that "-more-" prompts and questions which insist on
+ * an answer (e.g. the last words) never stall the benchmark.
+ */
+static errr term_xtra_bench(int n, int v)
+{
+    static bool escaped = FALSE;
+    switch (n) {
+    case TERM_XTRA_EVENT:
+        if (!v)
+            return 0;
+
+        escaped = !escaped;
+        term_key_push(escaped ? ESCAPE : '\r');
+        return 0;
+    case TERM_XTRA_FLUSH:
+    case TERM_XTRA_DELAY:
+        return 0;
+    }
+
+    return 1;
+}
+
+/*!
+ * @brief 表示を伴わない端末を用意する / Prepare a term without any display
+ * @return なし
+ */
+static void init_bench_term(void)
+{
+    term_type *t = &term_bench_body;
+    term_init(t, 80, 24, 256);
+    t->attr_blank = TERM_WHITE;
+    t->char_blank = ' ';
+    t->never_bored = TRUE;
+    t->text_hook = term_text_bench;
+    t->wipe_hook = term_wipe_bench;
+    t->curs_hook = term_curs_bench;
+    t->xtra_hook = term_xtra_bench;
+    angband_term[0] = t;
+    term_activate(t);
+}
+
+/*
+ * Initialize the file paths (see "init_stuff()" in main.c).
+ */
+static void init_bench_paths(void)
+{
+    char libpath[1024], varpath[1024];
+    concptr tail = getenv("ANGBAND_PATH");
+    strncpy(libpath, tail ? tail : DEFAULT_LIB_PATH, 511);
+    strncpy(varpath, tail ? tail : DEFAULT_VAR_PATH, 511);
+    libpath[511] = '\0';
+    varpath[511] = '\0';
+    if (!suffix(libpath, PATH_SEP))
+        strcat(libpath, PATH_SEP);
+
+    if (!suffix(varpath, PATH_SEP))
+        strcat(varpath, PATH_SEP);
+
+    init_file_paths(libpath, varpath);
+}
+
+/*!
+ * @brief セーブファイルを読み込んで計測対象のフロアを用意する / Load the savefile and prepare the floor to measure
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param seed 乱数シード
+ * @param depth 0以外なら、この階層のフロアを新たに生成して計測する
+ * @return なし
+ */
+static void prepare_bench_floor(player_type *player_ptr, u32b seed, DEPTH depth)
+{
+    bool new_game = FALSE;
+    if (!load_savedata(player_ptr, &new_game) || new_game)
+        quit_fmt("Cannot load the savefile '%s'", savefile);
+
+    if (player_ptr->is_dead)
+        quit("The character in the savefile is already dead.");
+
+    extract_option_vars();
+    process_player_name(player_ptr, FALSE);
+
+    /* Never touch the savefile nor wait for the user */
+    autosave_l = FALSE;
+    autosave_t = FALSE;
+    auto_more = TRUE;
+
+    Rand_state_set(seed);
+    current_world_ptr->character_icky = FALSE;
+    set_floor_and_wall(player_ptr->dungeon_idx);
+    flavor_init();
+    parse_fixed_map(player_ptr, "w_info.txt", 0, 0, current_world_ptr->max_wild_y, current_world_ptr->max_wild_x);
+    init_flags = INIT_ONLY_BUILDINGS;
+    parse_fixed_map(player_ptr, "t_info.txt", 0, 0, MAX_HGT, MAX_WID);
+
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    if (depth > 0) {
+        if (!player_ptr->dungeon_idx)
+            player_ptr->dungeon_idx = DUNGEON_ANGBAND;
+
+        if (depth > d_info[player_ptr->dungeon_idx].maxdepth)
+            depth = d_info[player_ptr->dungeon_idx].maxdepth;
+
+        floor_ptr->dun_level = depth;
+        floor_ptr->inside_quest = 0;
+        floor_ptr->inside_arena = FALSE;
+        player_ptr->wild_mode = FALSE;
+        prepare_change_floor_mode(player_ptr, CFM_RAND_PLACE | CFM_FIRST_FLOOR);
+        leave_floor(player_ptr);
+        wipe_o_list(floor_ptr);
+        wipe_monsters_list(player_ptr);
+        change_floor(player_ptr);
+    } else if (!current_world_ptr->character_dungeon) {
+        change_floor(player_ptr);
+    }
+
+    current_world_ptr->character_generated = TRUE;
+    player_ptr->playing = TRUE;
+    reset_visuals(player_ptr, process_autopick_file_command);
+
+    floor_ptr->base_level = floor_ptr->dun_level;
+    floor_ptr->monster_level = floor_ptr->base_level;
+    floor_ptr->object_level = floor_ptr->base_level;
+    player_ptr->leaving = FALSE;
+    player_ptr->energy_need = 0;
+    panel_bounds_center();
+    verify_panel(player_ptr);
+
+    current_world_ptr->character_xtra = TRUE;
+    player_ptr->update |= (PU_BONUS | PU_HP | PU_MANA | PU_SPELLS | PU_VIEW | PU_LITE | PU_MON_LITE | PU_TORCH | PU_MONSTERS | PU_DISTANCE | PU_FLOW);
+    handle_stuff(player_ptr);
+    current_world_ptr->character_xtra = FALSE;
+    current_world_ptr->is_loading_now = TRUE;
+    mproc_init(floor_ptr);
+
+    /* The measured run must not depend on how the floor came to be */
+    Rand_state_set(seed);
+}
+
+/*!
+ * @brief プレイヤーを休憩状態のまま生かしておく / Keep the player resting and alive
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return なし
+ * @details
+ * 休憩が中断された場合、プレイヤーの手番で入力待ちにならないよう捜索コマンドを積んでおく。
+ * 計測が途中で終わらないよう、HPは毎ターン全快させ無敵状態も維持する。
+ */
+static void keep_bench_player(player_type *player_ptr)
+{
+    if (player_ptr->action != ACTION_REST) {
+        player_ptr->resting = BENCH_REST_COUNT;
+        set_action(player_ptr, ACTION_REST);
+    }
+
+    command_new = 's';
+    player_ptr->chp = player_ptr->mhp;
+    player_ptr->chp_frac = 0;
+    player_ptr->invuln = BENCH_INVULN_TURNS;
+}
+
+/*!
+ * @brief 計測対象のゲームターンを指定回数回す / Run the measured game turns
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param turns 回すゲームターン数
+ * @param result 計測結果の格納先
+ * @return なし
+ * @details
+ * process_dungeon() のメインループと同じ順序で各処理を呼ぶ。
+ */
+static void run_bench_turns(player_type *player_ptr, s32b turns, bench_result_type *result)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    double start = bench_now();
+    double lap;
+    for (result->turns = 0; result->turns < turns; result->turns++) {
+        lap = bench_now();
+        if ((floor_ptr->m_cnt + 32 > current_world_ptr->max_m_idx) && !player_ptr->phase_out)
+            compact_monsters(player_ptr, 64);
+
+        if ((floor_ptr->m_cnt + 32 < floor_ptr->m_max) && !player_ptr->phase_out)
+            compact_monsters(player_ptr, 0);
+
+        if (floor_ptr->o_cnt + 32 > current_world_ptr->max_o_idx)
+            compact_objects(player_ptr, 64);
+
+        if (floor_ptr->o_cnt + 32 < floor_ptr->o_max)
+            compact_objects(player_ptr, 0);
+
+        result->section[BENCH_COMPACT] += bench_now() - lap;
+
+        keep_bench_player(player_ptr);
+        lap = bench_now();
+        process_player(player_ptr);
+        process_upkeep_with_speed(player_ptr);
+        result->section[BENCH_PLAYER] += bench_now() - lap;
+
+        lap = bench_now();
+        handle_stuff(player_ptr);
+        result->section[BENCH_STUFF] += bench_now() - lap;
+        if (!player_ptr->playing || player_ptr->is_dead)
+            break;
+
+        lap = bench_now();
+        process_monsters(player_ptr);
+        result->section[BENCH_MONSTERS] += bench_now() - lap;
+
+        lap = bench_now();
+        handle_stuff(player_ptr);
+        result->section[BENCH_STUFF] += bench_now() - lap;
+        if (!player_ptr->playing || player_ptr->is_dead)
+            break;
+
+        lap = bench_now();
+        process_world(player_ptr);
+        result->section[BENCH_WORLD] += bench_now() - lap;
+
+        lap = bench_now();
+        handle_stuff(player_ptr);
+        result->section[BENCH_STUFF] += bench_now() - lap;
+        if (!player_ptr->playing || player_ptr->is_dead)
+            break;
+
+        current_world_ptr->game_turn++;
+        if (current_world_ptr->dungeon_turn < current_world_ptr->dungeon_turn_limit) {
+            if (!player_ptr->wild_mode || wild_regen)
+                current_world_ptr->dungeon_turn++;
+            else if (player_ptr->wild_mode && !(current_world_ptr->game_turn % ((MAX_HGT + MAX_WID) / 2)))
+                current_world_ptr->dungeon_turn++;
+        }
+
+        prevent_turn_overflow(player_ptr);
+        if (player_ptr->leaving) {
+            result->turns++;
+            result->stop_reason = "the player left the floor";
+            break;
+        }
+
+        if (wild_regen)
+            wild_regen--;
+    }
+
+    if (player_ptr->is_dead)
+        result->stop_reason = "the player died";
+    else if (!player_ptr->playing)
+        result->stop_reason = "the game was stopped";
+
+    result->elapsed = bench_now() - start;
+}
+
+/*!
+ * @brief ダイジェストに値を1つ混ぜ込む (FNV-1a) / Fold one value into the state digest
+ * @param digest これまでのダイジェスト
+ * @param value 混ぜ込む値
+ * @return 新しいダイジェスト
+ */
+static u32b mix_bench_digest(u32b digest, u32b value)
+{
+    return (digest ^ value) * 16777619UL;
+}
+
+/*!
+ * @brief 計測後のゲーム状態のダイジェストを求める / Compute a digest of the game state after the run
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return ダイジェスト
+ * @details
+ * モンスターとアイテムの一覧、各グリッドの地形・フラグ・経路情報、プレイヤーの位置と経験値、
+ * 乱数の内部状態、ゲームターン数、メッセージ数を対象とする。
+ * 同じセーブファイルと引数で実行した時に値が変われば、処理結果が変わったことになる。
+ */
+static u32b compute_bench_digest(player_type *player_ptr)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    u32b digest = 2166136261UL;
+    for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
+        monster_type *m_ptr = &floor_ptr->m_list[i];
+        digest = mix_bench_digest(digest, (u32b)m_ptr->r_idx);
+        digest = mix_bench_digest(digest, (u32b)m_ptr->fy);
+        digest = mix_bench_digest(digest, (u32b)m_ptr->fx);
+        digest = mix_bench_digest(digest, (u32b)m_ptr->hp);
+        digest = mix_bench_digest(digest, (u32b)m_ptr->energy_need);
+        digest = mix_bench_digest(digest, (u32b)m_ptr->mflag);
+    }
+
+    for (OBJECT_IDX i = 1; i < floor_ptr->o_max; i++) {
+        object_type *o_ptr = &floor_ptr->o_list[i];
+        digest = mix_bench_digest(digest, (u32b)o_ptr->k_idx);
+        digest = mix_bench_digest(digest, (u32b)o_ptr->iy);
+        digest = mix_bench_digest(digest, (u32b)o_ptr->ix);
+        digest = mix_bench_digest(digest, (u32b)o_ptr->number);
+    }
+
+    for (POSITION y = 0; y < floor_ptr->height; y++) {
+        for (POSITION x = 0; x < floor_ptr->width; x++) {
+            grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+            digest = mix_bench_digest(digest, (u32b)g_ptr->feat);
+            digest = mix_bench_digest(digest, (u32b)g_ptr->info);
+            digest = mix_bench_digest(digest, (u32b)g_ptr->m_idx);
+            digest = mix_bench_digest(digest, (u32b)g_ptr->o_idx);
+            digest = mix_bench_digest(digest, (u32b)floor_ptr->cost_array[y][x]);
+            digest = mix_bench_digest(digest, (u32b)floor_ptr->dist_array[y][x]);
+            digest = mix_bench_digest(digest, (u32b)floor_ptr->when_array[y][x]);
+        }
+    }
+
+    digest = mix_bench_digest(digest, (u32b)player_ptr->y);
+    digest = mix_bench_digest(digest, (u32b)player_ptr->x);
+    digest = mix_bench_digest(digest, (u32b)player_ptr->exp);
+    digest = mix_bench_digest(digest, Rand_state[0]);
+    digest = mix_bench_digest(digest, (u32b)Rand_place);
+    digest = mix_bench_digest(digest, (u32b)current_world_ptr->game_turn);
+    digest = mix_bench_digest(digest, (u32b)message_num());
+    return digest;
+}
+
+/*!
+ * @brief 計測結果を表示する / Print the benchmark result
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param result 計測結果
+ * @return なし
+ */
+static void print_bench_result(player_type *player_ptr, bench_result_type *result)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("floor      : level %d, %dx%d, %d monsters, %d objects\n", (int)floor_ptr->dun_level, (int)floor_ptr->width, (int)floor_ptr->height,
+        (int)floor_ptr->m_cnt, (int)floor_ptr->o_cnt);
+    printf("turns      : %ld\n", (long)result->turns);
+    if (result->stop_reason)
+        printf("stopped    : %s\n", result->stop_reason);
+
+    printf("elapsed    : %.3f s\n", result->elapsed);
+    printf("turns/sec  : %.1f\n", result->elapsed > 0 ? result->turns / result->elapsed : 0.0);
+    for (int i = 0; i < MAX_BENCH_SECTION; i++)
+        printf("  %-9s: %.3f s (%5.1f%%)\n", bench_section_names[i], result->section[i],
+            result->elapsed > 0 ? 100.0 * result->section[i] / result->elapsed : 0.0);
+
+    printf("peak RSS   : %ld KiB\n", (long)usage.ru_maxrss);
+    printf("digest     : %08lx\n", (unsigned long)compute_bench_digest(player_ptr));
+}
+
+static void display_bench_usage(void)
+{
+    puts("Usage: hengband-bench [options] <savefile>");
+    puts("  -t<num>  Run <num> game turns (default 10000)");
+    puts("  -s<num>  Use <num> as the random seed");
+    puts("  -l<num>  Generate a fresh floor at dungeon level <num>");
+    quit(NULL);
+}
+
+/*!
+ * @brief ベンチマークのメインルーチン / Benchmark entry point
+ */
+int main(int argc, char *argv[])
+{
+    s32b turns = BENCH_DEFAULT_TURNS;
+    u32b seed = BENCH_DEFAULT_SEED;
+    DEPTH depth = 0;
+    concptr path = NULL;
+
+    argv0 = argv[0];
+    init_bench_paths();
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') {
+            path = argv[i];
+            continue;
+        }
+
+        switch (argv[i][1]) {
+        case 't':
+            turns = atol(&argv[i][2]);
+            break;
+        case 's':
+            seed = (u32b)strtoul(&argv[i][2], NULL, 0);
+            break;
+        case 'l':
+            depth = (DEPTH)atoi(&argv[i][2]);
+            break;
+        default:
+            display_bench_usage();
+            break;
+        }
+    }
+
+    if (!path || (turns <= 0))
+        display_bench_usage();
+
+    angband_strcpy(savefile, path, sizeof(savefile));
+    init_bench_term();
+    ANGBAND_SYS = "bench";
+    init_angband(p_ptr, process_autopick_file_command);
+    prepare_bench_floor(p_ptr, seed, depth);
+
+    bench_result_type result;
+    (void)WIPE(&result, bench_result_type);
+    run_bench_turns(p_ptr, turns, &result);
+    print_bench_result(p_ptr, &result);
+
+    clear_saved_floor_files(p_ptr);
+    quit(NULL);
+    return 0;
+}
@@ -3375,6 +3375,11 @@ static void hack_quit(concptr str)
     exit(0);
 }
 
+/*
+ * Get the current time in milliseconds (see "z-term.c")
+ */
+static u32b hook_clock(void) { return (u32b)timeGetTime(); }
+
 /*
  * Display warning message (see "z-util.c")
  */
@@ -3587,6 +3592,7 @@ int PASCAL WinMain(HINSTANCE hInst, HINSTANCE hPrevInst, LPSTR lpCmdLine, int nC
     plog_aux = hook_plog;
     quit_aux = hook_quit;
     core_aux = hook_quit;
+    term_clock_aux = hook_clock;
 
     ANGBAND_SYS = "win";
     if (7 != GetKeyboardType(0))
@@ -247,6 +247,7 @@ static void display_usage(void)
     puts("  -r       Request rogue-like keyset");
     puts("  -M       Request monochrome mode");
     puts("  -s<num>  Show <num> high scores");
+    puts("  -p<fps>  Limit screen updates in repeated commands (0: no limit)");
     puts("  -u<who>  Use your <who> savefile");
     puts("  -m<sys>  Force 'main-<sys>.c' usage");
     puts("  -d<def>  Define a 'lib' dir sub-path");
@@ -407,6 +408,13 @@ int main(int argc, char *argv[])
                 show_score = 10;
             break;
         }
+        case 'P':
+        case 'p': {
+            term_fresh_fps = atoi(&argv[i][2]);
+            if (term_fresh_fps < 0)
+                term_fresh_fps = 0;
+            break;
+        }
         case 'u':
         case 'U': {
             if (!argv[i][2]) {
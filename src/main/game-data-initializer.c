@@ -16,6 +16,7 @@
 #include "util/quarks.h"
 #include "util/tag-sorter.h"
 #include "view/display-messages.h"
+#include "world/world-object.h"
 #include "world/world.h"
 
 /*!
@@ -49,12 +50,23 @@ errr init_other(player_type *player_ptr)
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     C_MAKE(floor_ptr->o_list, current_world_ptr->max_o_idx, object_type);
     C_MAKE(floor_ptr->m_list, current_world_ptr->max_m_idx, monster_type);
+    C_MAKE(floor_ptr->m_active, (current_world_ptr->max_m_idx + 31) / 32, BIT_FLAGS);
     for (int i = 0; i < MAX_MTIMED; i++)
         C_MAKE(floor_ptr->mproc_list[i], current_world_ptr->max_m_idx, s16b);
 
     C_MAKE(max_dlv, current_world_ptr->max_d_idx, DEPTH);
-    for (int i = 0; i < MAX_HGT; i++)
-        C_MAKE(floor_ptr->grid_array[i], MAX_WID, grid_type);
+    C_MAKE(floor_ptr->grid_array[0], MAX_HGT * MAX_WID, grid_type);
+    C_MAKE(floor_ptr->cost_array[0], MAX_HGT * MAX_WID, byte);
+    C_MAKE(floor_ptr->dist_array[0], MAX_HGT * MAX_WID, byte);
+    C_MAKE(floor_ptr->when_array[0], MAX_HGT * MAX_WID, byte);
+    C_MAKE(floor_ptr->pass_array[0], MAX_HGT * MAX_WID, BIT_FLAGS8);
+    for (int i = 1; i < MAX_HGT; i++) {
+        floor_ptr->grid_array[i] = floor_ptr->grid_array[i - 1] + MAX_WID;
+        floor_ptr->cost_array[i] = floor_ptr->cost_array[i - 1] + MAX_WID;
+        floor_ptr->dist_array[i] = floor_ptr->dist_array[i - 1] + MAX_WID;
+        floor_ptr->when_array[i] = floor_ptr->when_array[i - 1] + MAX_WID;
+        floor_ptr->pass_array[i] = floor_ptr->pass_array[i - 1] + MAX_WID;
+    }
 
     C_MAKE(macro__pat, MACRO_MAX, concptr);
     C_MAKE(macro__act, MACRO_MAX, concptr);
@@ -62,7 +74,8 @@ errr init_other(player_type *player_ptr)
     C_MAKE(macro__buf, FILE_READ_BUFF_SIZE, char);
     quark_init();
 
-    C_MAKE(message__ptr, MESSAGE_MAX, u32b);
+    C_MAKE(message__log, MESSAGE_MAX, message_type);
+    C_MAKE(message__hash, MESSAGE_HASH_SIZE, u32b);
     C_MAKE(message__buf, MESSAGE_BUF, char);
     message__tail = MESSAGE_BUF;
 
@@ -152,6 +165,7 @@ errr init_object_alloc(void)
         }
     }
 
+    reset_obj_num_table();
     return 0;
 }
 
@@ -31,6 +31,9 @@
 #ifndef WINDOWS
 #include <sys/types.h>
 #endif
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
 
 /*!
  * @brief 基本情報読み込みのメインルーチン /
@@ -40,6 +43,47 @@
  */
 errr init_misc(player_type *player_ptr) { return parse_fixed_map(player_ptr, "misc.txt", 0, 0, 0, 0); }
 
+/*!
+ * @brief rawファイルをメモリにマップしてそのまま使う
+ * Map the body of an "image" file into memory instead of copying it
+ * @param fd ファイルディスクリプタ
+ * @param head rawファイルのヘッダ (読み込み済み)
+ * @return マップできたらTRUE
+ * @details
+ * 名前やテキストはオフセットで参照されるので、rawファイルの中身は置かれた位置に依らずそのまま使える。
+ * プライベートマップなので書き換えたページだけがプロセスごとに複製され、
+ * 残り (名前やテキストの大半) は同じファイルを開いた他のプロセスと共有される。
+ * マップはゲーム終了まで解放しない。
+ */
+static bool map_info_raw(int fd, angband_header *head)
+{
+#ifdef HAVE_MMAP
+    size_t offset = head->head_size;
+    size_t size = offset + head->info_size + head->name_size + head->text_size + head->tag_size;
+    struct stat raw_stat;
+    if (fstat(fd, &raw_stat) || ((size_t)raw_stat.st_size < size))
+        return FALSE;
+
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+        return FALSE;
+
+    char *base = (char *)map;
+    head->info_ptr = base + offset;
+    offset += head->info_size;
+    head->name_ptr = head->name_size ? base + offset : NULL;
+    offset += head->name_size;
+    head->text_ptr = head->text_size ? base + offset : NULL;
+    offset += head->text_size;
+    head->tag_ptr = head->tag_size ? base + offset : NULL;
+    return TRUE;
+#else
+    (void)fd;
+    (void)head;
+    return FALSE;
+#endif
+}
+
 /*!
  * @brief rawファイルからのデータの読み取り処理
  * Initialize the "*_info" array, by parsing a binary "image" file
@@ -57,6 +101,9 @@ static errr init_info_raw(int fd, angband_header *head)
     }
 
     *head = test;
+    if (map_info_raw(fd, head))
+        return 0;
+
     C_MAKE(head->info_ptr, head->info_size, char);
     fd_read(fd, head->info_ptr, head->info_size);
     if (head->name_size) {
@@ -216,8 +216,8 @@ bool shock_power(player_type *caster_ptr)
         return TRUE;
 
     msg_format(_("%sを吹き飛ばした！", "You blow %s away!"), m_name);
-    caster_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = 0;
-    caster_ptr->current_floor_ptr->grid_array[ty][tx].m_idx = m_idx;
+    set_cave_monster(caster_ptr->current_floor_ptr, oy, ox, 0);
+    set_cave_monster(caster_ptr->current_floor_ptr, ty, tx, m_idx);
     m_ptr->fy = ty;
     m_ptr->fx = tx;
 
@@ -65,7 +65,7 @@ void delete_monster_idx(player_type *player_ptr, MONSTER_IDX i)
     if (player_ptr->riding == i)
         player_ptr->riding = 0;
 
-    floor_ptr->grid_array[y][x].m_idx = 0;
+    set_cave_monster(floor_ptr, y, x, 0);
     OBJECT_IDX next_o_idx = 0;
     for (OBJECT_IDX this_o_idx = m_ptr->hold_o_idx; this_o_idx; this_o_idx = next_o_idx) {
         object_type *o_ptr;
@@ -116,7 +116,7 @@ void wipe_monsters_list(player_type *player_ptr)
         if (!monster_is_valid(m_ptr))
             continue;
 
-        floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].m_idx = 0;
+        set_cave_monster(floor_ptr, m_ptr->fy, m_ptr->fx, 0);
         (void)WIPE(m_ptr, monster_type);
     }
 
@@ -5,6 +5,7 @@
  */
 
 #include "monster-floor/monster-safety-hiding.h"
+#include "effect/spells-effect-util.h"
 #include "floor/cave.h"
 #include "grid/grid.h"
 #include "monster-floor/monster-dist-offsets.h"
@@ -14,6 +15,66 @@
 #include "mspell/mspell-checker.h"
 #include "system/floor-type-definition.h"
 #include "target/projection-path-calculator.h"
+#include "world/world.h"
+
+/*!
+ * @brief プレイヤーから各マスへの射線の有無を覚えておく表 / Cache of projectable() from the player
+ * @details
+ * フロア生成後の projectable() の結果はプレイヤーの位置・射程・フロアの大きさ・
+ * 通過特性 (floor_type::pass_array) だけで決まる。
+ * これらが変わらない間は、逃走先や隠れ場所を探す全モンスターで結果を使い回す。
+ */
+typedef struct projectable_cache_type {
+    u32b stamp; /*!< 現在の表の世代 / Current generation of the table */
+    POSITION y;
+    POSITION x;
+    POSITION height;
+    POSITION width;
+    int range;
+    u32b pass_version;
+    u32b checked[MAX_HGT][MAX_WID]; /*!< 結果を求めた世代 / Generation when each result was computed */
+    bool projectable[MAX_HGT][MAX_WID];
+} projectable_cache_type;
+
+static projectable_cache_type projectable_cache;
+
+/*!
+ * @brief プレイヤーから指定マスへ射線が通るかを返す / projectable() from the player, cached
+ * @param target_ptr プレーヤーへの参照ポインタ
+ * @param y 指定Y座標
+ * @param x 指定X座標
+ * @return 射線が通るならTRUE
+ */
+static bool projectable_from_player(player_type *target_ptr, POSITION y, POSITION x)
+{
+    if (!current_world_ptr->character_dungeon)
+        return projectable(target_ptr, target_ptr->y, target_ptr->x, y, x);
+
+    floor_type *floor_ptr = target_ptr->current_floor_ptr;
+    projectable_cache_type *cache_ptr = &projectable_cache;
+    int range = project_length ? project_length : get_max_range(target_ptr);
+    if ((cache_ptr->stamp == 0) || (cache_ptr->y != target_ptr->y) || (cache_ptr->x != target_ptr->x) || (cache_ptr->height != floor_ptr->height)
+        || (cache_ptr->width != floor_ptr->width) || (cache_ptr->range != range) || (cache_ptr->pass_version != floor_ptr->pass_version)) {
+        if (++cache_ptr->stamp == 0) {
+            (void)C_WIPE(cache_ptr->checked, MAX_HGT * MAX_WID, u32b);
+            cache_ptr->stamp = 1;
+        }
+
+        cache_ptr->y = target_ptr->y;
+        cache_ptr->x = target_ptr->x;
+        cache_ptr->height = floor_ptr->height;
+        cache_ptr->width = floor_ptr->width;
+        cache_ptr->range = range;
+        cache_ptr->pass_version = floor_ptr->pass_version;
+    }
+
+    if (cache_ptr->checked[y][x] != cache_ptr->stamp) {
+        cache_ptr->checked[y][x] = cache_ptr->stamp;
+        cache_ptr->projectable[y][x] = projectable(target_ptr, target_ptr->y, target_ptr->x, y, x);
+    }
+
+    return cache_ptr->projectable[y][x];
+}
 
 /*!
  * @brief モンスターが逃げ込める地点を走査する
@@ -29,6 +90,8 @@ static coordinate_candidate sweep_safe_coordinate(player_type *target_ptr, MONST
     coordinate_candidate candidate = init_coordinate_candidate();
     floor_type *floor_ptr = target_ptr->current_floor_ptr;
     monster_type *m_ptr = &target_ptr->current_floor_ptr->m_list[m_idx];
+    monster_race *r_ptr = &r_info[m_ptr->r_idx];
+    BIT_FLAGS16 riding_mode = (m_idx == target_ptr->riding) ? CEM_RIDING : 0;
     for (POSITION i = 0, dx = x_offsets[0], dy = y_offsets[0]; dx != 0 || dy != 0; i++, dx = x_offsets[i], dy = y_offsets[i]) {
         POSITION y = m_ptr->fy + dy;
         POSITION x = m_ptr->fx + dx;
@@ -38,24 +101,23 @@ static coordinate_candidate sweep_safe_coordinate(player_type *target_ptr, MONST
         grid_type *g_ptr;
         g_ptr = &floor_ptr->grid_array[y][x];
 
-        BIT_FLAGS16 riding_mode = (m_idx == target_ptr->riding) ? CEM_RIDING : 0;
-        if (!monster_can_cross_terrain(target_ptr, g_ptr->feat, &r_info[m_ptr->r_idx], riding_mode))
+        if (!monster_can_cross_terrain(target_ptr, g_ptr->feat, r_ptr, riding_mode))
             continue;
 
         if (!(m_ptr->mflag2 & MFLAG2_NOFLOW)) {
-            if (g_ptr->dist == 0)
+            if (floor_ptr->dist_array[y][x] == 0)
                 continue;
-            if (g_ptr->dist > floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].dist + 2 * d)
+            if (floor_ptr->dist_array[y][x] > floor_ptr->dist_array[m_ptr->fy][m_ptr->fx] + 2 * d)
                 continue;
         }
 
-        if (projectable(target_ptr, target_ptr->y, target_ptr->x, y, x))
-            continue;
-
         POSITION dis = distance(y, x, target_ptr->y, target_ptr->x);
         if (dis <= candidate.gdis)
             continue;
 
+        if (projectable_from_player(target_ptr, y, x))
+            continue;
+
         candidate.gy = y;
         candidate.gx = x;
         candidate.gdis = dis;
@@ -125,17 +187,17 @@ static void sweep_hiding_candidate(
         POSITION x = m_ptr->fx + dx;
         if (!in_bounds(target_ptr->current_floor_ptr, y, x))
             continue;
+        POSITION dis = distance(y, x, target_ptr->y, target_ptr->x);
+        if (dis >= candidate->gdis || dis < 2)
+            continue;
         if (!monster_can_enter(target_ptr, y, x, r_ptr, 0))
             continue;
-        if (projectable(target_ptr, target_ptr->y, target_ptr->x, y, x) || !clean_shot(target_ptr, m_ptr->fy, m_ptr->fx, y, x, FALSE))
+        if (projectable_from_player(target_ptr, y, x) || !clean_shot(target_ptr, m_ptr->fy, m_ptr->fx, y, x, FALSE))
             continue;
 
-        POSITION dis = distance(y, x, target_ptr->y, target_ptr->x);
-        if (dis < candidate->gdis && dis >= 2) {
-            candidate->gy = y;
-            candidate->gx = x;
-            candidate->gdis = dis;
-        }
+        candidate->gy = y;
+        candidate->gx = x;
+        candidate->gdis = dis;
     }
 }
 
@@ -93,7 +93,7 @@ static bool sweep_ranged_attack_grid(player_type *target_ptr, MONSTER_IDX m_idx,
 
 	if (projectable(target_ptr, y1, x1, target_ptr->y, target_ptr->x)) return FALSE;
 
-	int now_cost = floor_ptr->grid_array[y1][x1].cost;
+	int now_cost = floor_ptr->cost_array[y1][x1];
 	if (now_cost == 0) now_cost = 999;
 
 	bool can_open_door = FALSE;
@@ -112,7 +112,7 @@ static bool sweep_ranged_attack_grid(player_type *target_ptr, MONSTER_IDX m_idx,
 
 		grid_type *g_ptr;
 		g_ptr = &floor_ptr->grid_array[y][x];
-		int cost = g_ptr->cost;
+		int cost = floor_ptr->cost_array[y][x];
 		if (!(((r_ptr->flags2 & RF2_PASS_WALL) && ((m_idx != target_ptr->riding) || has_pass_wall(target_ptr))) || ((r_ptr->flags2 & RF2_KILL_WALL) && (m_idx != target_ptr->riding))))
 		{
 			if (cost == 0) continue;
@@ -166,7 +166,6 @@ static bool sweep_ranged_attack_grid(player_type *target_ptr, MONSTER_IDX m_idx,
  */
 static void sweep_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, POSITION *yp, POSITION *xp, bool no_flow)
 {
-	grid_type *g_ptr;
 	floor_type *floor_ptr = target_ptr->current_floor_ptr;
 	monster_type *m_ptr = &floor_ptr->m_list[m_idx];
 	monster_race *r_ptr = &r_info[m_ptr->r_idx];
@@ -186,17 +185,15 @@ static void sweep_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, POSIT
 	POSITION x1 = m_ptr->fx;
 	if (player_has_los_bold(target_ptr, y1, x1) && projectable(target_ptr, target_ptr->y, target_ptr->x, y1, x1)) return;
 
-	g_ptr = &floor_ptr->grid_array[y1][x1];
-
 	int best;
 	bool use_scent = FALSE;
-	if (g_ptr->cost)
+	if (floor_ptr->cost_array[y1][x1])
 	{
 		best = 999;
 	}
-	else if (g_ptr->when)
+	else if (floor_ptr->when_array[y1][x1])
 	{
-		if (floor_ptr->grid_array[target_ptr->y][target_ptr->x].when - g_ptr->when > 127) return;
+		if (floor_ptr->when_array[target_ptr->y][target_ptr->x] - floor_ptr->when_array[y1][x1] > 127) return;
 
 		use_scent = TRUE;
 		best = 0;
@@ -213,10 +210,9 @@ static void sweep_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, POSIT
 
 		if (!in_bounds2(floor_ptr, y, x)) continue;
 
-		g_ptr = &floor_ptr->grid_array[y][x];
 		if (use_scent)
 		{
-			int when = g_ptr->when;
+			int when = floor_ptr->when_array[y][x];
 			if (best > when) continue;
 
 			best = when;
@@ -226,11 +222,11 @@ static void sweep_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, POSIT
 			int cost;
 			if (r_ptr->flags2 & (RF2_BASH_DOOR | RF2_OPEN_DOOR))
 			{
-				cost = g_ptr->dist;
+				cost = floor_ptr->dist_array[y][x];
 			}
 			else
 			{
-				cost = g_ptr->cost;
+				cost = floor_ptr->cost_array[y][x];
 			}
 
 			if ((cost == 0) || (best < cost)) continue;
@@ -275,7 +271,7 @@ static bool sweep_runnable_away_grid(floor_type *floor_ptr, MONSTER_IDX m_idx, P
 		if (!in_bounds2(floor_ptr, y, x)) continue;
 
 		POSITION dis = distance(y, x, y1, x1);
-		POSITION s = 5000 / (dis + 3) - 500 / (floor_ptr->grid_array[y][x].dist + 1);
+		POSITION s = 5000 / (dis + 3) - 500 / (floor_ptr->dist_array[y][x] + 1);
 		if (s < 0) s = 0;
 
 		if (s < score) continue;
@@ -314,7 +310,7 @@ bool get_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, DIRECTION *mm)
 	bool done = FALSE;
 	bool will_run = mon_will_run(target_ptr, m_idx);
 	grid_type *g_ptr;
-	bool no_flow = ((m_ptr->mflag2 & MFLAG2_NOFLOW) != 0) && (floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].cost > 2);
+	bool no_flow = ((m_ptr->mflag2 & MFLAG2_NOFLOW) != 0) && (floor_ptr->cost_array[m_ptr->fy][m_ptr->fx] > 2);
 	bool can_pass_wall = ((r_ptr->flags2 & RF2_PASS_WALL) != 0) && ((m_idx != target_ptr->riding) || has_pass_wall(target_ptr));
 
 	if (!will_run && m_ptr->target_y)
@@ -334,7 +330,7 @@ bool get_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, DIRECTION *mm)
 	if (!done && !will_run && is_hostile(m_ptr) &&
 		(r_ptr->flags1 & RF1_FRIENDS) &&
 		((los(target_ptr, m_ptr->fy, m_ptr->fx, target_ptr->y, target_ptr->x) && projectable(target_ptr, m_ptr->fy, m_ptr->fx, target_ptr->y, target_ptr->x)) ||
-		(floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].dist < MAX_SIGHT / 2)))
+		(floor_ptr->dist_array[m_ptr->fy][m_ptr->fx] < MAX_SIGHT / 2)))
 	{
 		if ((r_ptr->flags3 & RF3_ANIMAL) && !can_pass_wall &&
 			!(r_ptr->flags2 & RF2_KILL_WALL))
@@ -364,7 +360,7 @@ bool get_movable_grid(player_type *target_ptr, MONSTER_IDX m_idx, DIRECTION *mm)
 			}
 		}
 
-		if (!done && (floor_ptr->grid_array[m_ptr->fy][m_ptr->fx].dist < 3))
+		if (!done && (floor_ptr->dist_array[m_ptr->fy][m_ptr->fx] < 3))
 		{
 			for (int i = 0; i < 8; i++)
 			{
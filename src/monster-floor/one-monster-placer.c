@@ -251,7 +251,7 @@ bool place_monster_one(player_type *player_ptr, MONSTER_IDX who, POSITION y, POS
     if ((r_ptr->flags1 & RF1_UNIQUE) || (r_ptr->flags7 & RF7_NAZGUL) || (r_ptr->level < 10))
         mode &= ~PM_KAGE;
 
-    g_ptr->m_idx = m_pop(floor_ptr);
+    set_cave_monster(floor_ptr, y, x, m_pop(floor_ptr));
     hack_m_idx_ii = g_ptr->m_idx;
     if (!g_ptr->m_idx)
         return FALSE;
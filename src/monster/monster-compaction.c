@@ -9,6 +9,7 @@
 #include "monster/monster-describer.h"
 #include "monster/monster-description-types.h"
 #include "monster/monster-info.h"
+#include "monster/monster-list.h"
 #include "monster/monster-status.h"
 #include "system/floor-type-definition.h"
 #include "system/monster-type-definition.h"
@@ -34,9 +35,7 @@ static void compact_monsters_aux(player_type *player_ptr, MONSTER_IDX i1, MONSTE
 
     POSITION y = m_ptr->fy;
     POSITION x = m_ptr->fx;
-    grid_type *g_ptr;
-    g_ptr = &floor_ptr->grid_array[y][x];
-    g_ptr->m_idx = i2;
+    set_cave_monster(floor_ptr, y, x, i2);
 
     OBJECT_IDX next_o_idx = 0;
     for (OBJECT_IDX this_o_idx = m_ptr->hold_o_idx; this_o_idx; this_o_idx = next_o_idx) {
@@ -71,6 +70,7 @@ static void compact_monsters_aux(player_type *player_ptr, MONSTER_IDX i1, MONSTE
 
     (void)COPY(&floor_ptr->m_list[i2], &floor_ptr->m_list[i1], monster_type);
     (void)WIPE(&floor_ptr->m_list[i1], monster_type);
+    set_monster_active(floor_ptr, i2);
 
     for (int i = 0; i < MAX_MTIMED; i++) {
         int mproc_idx = get_mproc_idx(floor_ptr, i1, i);
@@ -16,6 +16,7 @@
 #include "dungeon/dungeon.h"
 #include "floor/cave.h"
 #include "floor/floor-object.h"
+#include "floor/geometry.h"
 #include "floor/wild.h"
 #include "game-option/birth-options.h"
 #include "game-option/cheat-options.h"
@@ -54,6 +55,7 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
         MONSTER_IDX i = floor_ptr->m_max;
         floor_ptr->m_max++;
         floor_ptr->m_cnt++;
+        set_monster_active(floor_ptr, i);
         return i;
     }
 
@@ -64,6 +66,7 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
         if (m_ptr->r_idx)
             continue;
         floor_ptr->m_cnt++;
+        set_monster_active(floor_ptr, i);
         return i;
     }
 
@@ -72,6 +75,118 @@ MONSTER_IDX m_pop(floor_type *floor_ptr)
     return 0;
 }
 
+/*!
+ * @brief モンスターを毎ターンの処理対象に加える / Mark a monster as possibly within AAF_LIMIT
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターID
+ * @return なし
+ * @details
+ * 配列の確保時とプレイヤーとの距離が AAF_LIMIT 未満に更新された時に呼ぶ。
+ */
+void set_monster_active(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    if (m_idx <= 0)
+        return;
+
+    floor_ptr->m_active[m_idx / 32] |= (1UL << (m_idx % 32));
+}
+
+/*!
+ * @brief モンスターを毎ターンの処理対象から外す / Mark a monster as dormant
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx モンスターID
+ * @return なし
+ */
+void set_monster_dormant(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    floor_ptr->m_active[m_idx / 32] &= ~(1UL << (m_idx % 32));
+}
+
+/*!
+ * @brief 指定ID以下で最大の処理対象モンスターを探す / Find the largest active monster index not greater than m_idx
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param m_idx 探索を始めるモンスターID
+ * @return 見つかったモンスターID、なければ0
+ * @details
+ * 休眠中のモンスターは32体単位で読み飛ばす。
+ * 処理中に新たに処理対象となったモンスターも拾えるよう、呼ぶたびにビット集合を読み直す。
+ */
+MONSTER_IDX find_active_monster(floor_type *floor_ptr, MONSTER_IDX m_idx)
+{
+    if (m_idx <= 0)
+        return 0;
+
+    BIT_FLAGS mask = 0xFFFFFFFFUL >> (31 - m_idx % 32);
+    for (int n = m_idx / 32; n >= 0; n--) {
+        BIT_FLAGS flags = floor_ptr->m_active[n] & mask;
+        mask = 0xFFFFFFFFUL;
+        if (!flags)
+            continue;
+
+        int bit = 31;
+        while (!(flags & (1UL << bit)))
+            bit--;
+
+        return (MONSTER_IDX)(n * 32 + bit);
+    }
+
+    return 0;
+}
+
+/*!
+ * @brief モンスターIDを昇順に並べるための比較関数 / Compare monster indexes for qsort()
+ * @param a 比較するモンスターIDへの参照ポインタ
+ * @param b 比較するモンスターIDへの参照ポインタ
+ * @return aが小さければ負、等しければ0、大きければ正
+ */
+static int compare_monster_idx(const void *a, const void *b)
+{
+    return *(const MONSTER_IDX *)a - *(const MONSTER_IDX *)b;
+}
+
+/*!
+ * @brief 指定地点から一定距離内にいるモンスターを列挙する / Collect monsters within a radius of a grid
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y 中心のY座標
+ * @param x 中心のX座標
+ * @param rad 半径 (distance() による距離)
+ * @param m_idx_list 見つかったモンスターIDの格納先 (max_m_idx 個分の領域が必要)
+ * @return 見つかったモンスターの数
+ * @details
+ * floor_type::m_bucket_num を見てモンスターのいない区画を読み飛ばすため、
+ * 走査量はm_listの長さではなく周囲のモンスター数に比例する。
+ * 結果はm_listを先頭から走査した場合と同じ順序になるよう、IDの昇順に並べて返す。
+ */
+MONSTER_NUMBER collect_monsters_in_radius(floor_type *floor_ptr, POSITION y, POSITION x, POSITION rad, MONSTER_IDX *m_idx_list)
+{
+    POSITION y1 = MAX(y - rad, 0);
+    POSITION y2 = MIN(y + rad, floor_ptr->height - 1);
+    POSITION x1 = MAX(x - rad, 0);
+    POSITION x2 = MIN(x + rad, floor_ptr->width - 1);
+    MONSTER_NUMBER num = 0;
+    for (POSITION by = y1 / MONSTER_BUCKET_SIZE; by <= y2 / MONSTER_BUCKET_SIZE; by++) {
+        for (POSITION bx = x1 / MONSTER_BUCKET_SIZE; bx <= x2 / MONSTER_BUCKET_SIZE; bx++) {
+            if (!floor_ptr->m_bucket_num[by][bx])
+                continue;
+
+            POSITION ye = MIN(by * MONSTER_BUCKET_SIZE + MONSTER_BUCKET_SIZE - 1, y2);
+            POSITION xe = MIN(bx * MONSTER_BUCKET_SIZE + MONSTER_BUCKET_SIZE - 1, x2);
+            for (POSITION yy = MAX(by * MONSTER_BUCKET_SIZE, y1); yy <= ye; yy++) {
+                for (POSITION xx = MAX(bx * MONSTER_BUCKET_SIZE, x1); xx <= xe; xx++) {
+                    MONSTER_IDX m_idx = floor_ptr->grid_array[yy][xx].m_idx;
+                    if (!m_idx || (distance(y, x, yy, xx) > rad))
+                        continue;
+
+                    m_idx_list[num++] = m_idx;
+                }
+            }
+        }
+    }
+
+    qsort(m_idx_list, num, sizeof(MONSTER_IDX), compare_monster_idx);
+    return num;
+}
+
 /*!
  * @brief 生成モンスター種族を1種生成テーブルから選択する
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -135,6 +250,7 @@ MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_leve
     /* Process probabilities */
     for (i = 0; i < alloc_race_size; i++) {
         table[i].prob3 = 0;
+        table[i].total = total;
         if (table[i].level < min_level)
             continue;
         if (max_level < table[i].level)
@@ -161,8 +277,11 @@ MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_leve
         mon_num++;
         table[i].prob3 = table[i].prob2;
         total += table[i].prob3;
+        table[i].total = total;
     }
 
+    int num = i;
+
     if (cheat_hear) {
         msg_format(_("モンスター第3次候補数:%d(%d-%dF)%d ", "monster third selection:%d(%d-%dF)%d "), mon_num, min_level, max_level, total);
     }
@@ -171,13 +290,7 @@ MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_leve
         return 0;
 
     value = randint0(total);
-    int found_count = 0;
-    for (i = 0; i < alloc_race_size; i++) {
-        if (value < table[i].prob3)
-            break;
-        value = value - table[i].prob3;
-        found_count++;
-    }
+    int found_count = find_alloc_entry(table, num, value);
 
     p = randint0(100);
 
@@ -185,13 +298,7 @@ MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_leve
     if (p < 60) {
         j = found_count;
         value = randint0(total);
-        for (found_count = 0; found_count < alloc_race_size; found_count++) {
-            if (value < table[found_count].prob3)
-                break;
-
-            value = value - table[found_count].prob3;
-        }
-
+        found_count = find_alloc_entry(table, num, value);
         if (table[found_count].level < table[j].level)
             found_count = j;
     }
@@ -200,13 +307,7 @@ MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_leve
     if (p < 10) {
         j = found_count;
         value = randint0(total);
-        for (found_count = 0; found_count < alloc_race_size; found_count++) {
-            if (value < table[found_count].prob3)
-                break;
-
-            value = value - table[found_count].prob3;
-        }
-
+        found_count = find_alloc_entry(table, num, value);
         if (table[found_count].level < table[j].level)
             found_count = j;
     }
@@ -4,6 +4,10 @@
 #include "system/monster-type-definition.h"
 
 MONSTER_IDX m_pop(floor_type *floor_ptr);
+void set_monster_active(floor_type *floor_ptr, MONSTER_IDX m_idx);
+void set_monster_dormant(floor_type *floor_ptr, MONSTER_IDX m_idx);
+MONSTER_IDX find_active_monster(floor_type *floor_ptr, MONSTER_IDX m_idx);
+MONSTER_NUMBER collect_monsters_in_radius(floor_type *floor_ptr, POSITION y, POSITION x, POSITION rad, MONSTER_IDX *m_idx_list);
 
 #define GMN_ARENA 0x00000001 //!< 賭け闘技場向け生成
 MONRACE_IDX get_mon_num(player_type *player_ptr, DEPTH min_level, DEPTH max_level, BIT_FLAGS option);
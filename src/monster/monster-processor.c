@@ -533,26 +533,39 @@ void process_monsters(player_type *target_ptr)
 /*!
  * @brief フロア内のモンスターについてターン終了時の処理を繰り返す
  * @param target_ptr プレーヤーへの参照ポインタ
+ * @details
+ * AAF_LIMIT より遠いモンスターは何もしないので、休眠扱いとして floor_type::m_active から外し、
+ * 距離が再び縮まるまで走査しない。
  */
 void sweep_monster_process(player_type *target_ptr)
 {
+    if (target_ptr->wild_mode)
+        return;
+
     floor_type *floor_ptr = target_ptr->current_floor_ptr;
-    for (MONSTER_IDX i = floor_ptr->m_max - 1; i >= 1; i--) {
+    for (MONSTER_IDX i = find_active_monster(floor_ptr, floor_ptr->m_max - 1); i >= 1; i = find_active_monster(floor_ptr, i - 1)) {
         monster_type *m_ptr;
         m_ptr = &floor_ptr->m_list[i];
 
         if (target_ptr->leaving)
             return;
 
-        if (!monster_is_valid(m_ptr) || target_ptr->wild_mode)
+        if (!monster_is_valid(m_ptr)) {
+            set_monster_dormant(floor_ptr, i);
             continue;
+        }
 
         if (m_ptr->mflag & MFLAG_BORN) {
             m_ptr->mflag &= ~(MFLAG_BORN);
             continue;
         }
 
-        if ((m_ptr->cdis >= AAF_LIMIT) || !decide_process_continue(target_ptr, m_ptr))
+        if (m_ptr->cdis >= AAF_LIMIT) {
+            set_monster_dormant(floor_ptr, i);
+            continue;
+        }
+
+        if (!decide_process_continue(target_ptr, m_ptr))
             continue;
 
         SPEED speed = (target_ptr->riding == i) ? target_ptr->pspeed : decide_monster_speed(m_ptr);
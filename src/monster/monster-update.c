@@ -24,6 +24,7 @@
 #include "monster-race/race-indice-types.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
+#include "monster/monster-list.h"
 #include "monster/monster-status.h"
 #include "monster/smart-learn-types.h"
 #include "player/eldritch-horror.h"
@@ -66,14 +67,14 @@ bool update_riding_monster(player_type *target_ptr, turn_flags *turn_flags_ptr,
     if (turn_flags_ptr->is_riding_mon)
         return move_player_effect(target_ptr, ny, nx, MPE_DONT_PICKUP);
 
-    target_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = g_ptr->m_idx;
+    set_cave_monster(target_ptr->current_floor_ptr, oy, ox, g_ptr->m_idx);
     if (g_ptr->m_idx) {
         y_ptr->fy = oy;
         y_ptr->fx = ox;
         update_monster(target_ptr, g_ptr->m_idx, TRUE);
     }
 
-    g_ptr->m_idx = m_idx;
+    set_cave_monster(target_ptr->current_floor_ptr, ny, nx, m_idx);
     m_ptr->fy = ny;
     m_ptr->fx = nx;
     update_monster(target_ptr, m_idx, TRUE);
@@ -172,13 +173,17 @@ static um_type *initialize_um_type(player_type *subject_ptr, um_type *um_ptr, MO
     return um_ptr;
 }
 
-static POSITION decide_updated_distance(player_type *subject_ptr, um_type *um_ptr)
+/*!
+ * @brief モンスターとプレイヤーの距離を計算し直す
+ * @param subject_ptr プレーヤーへの参照ポインタ
+ * @param m_idx モンスターID
+ * @return 更新後の距離
+ */
+static POSITION update_monster_distance(player_type *subject_ptr, MONSTER_IDX m_idx)
 {
-    if (!um_ptr->full)
-        return um_ptr->m_ptr->cdis;
-
-    int dy = (subject_ptr->y > um_ptr->fy) ? (subject_ptr->y - um_ptr->fy) : (um_ptr->fy - subject_ptr->y);
-    int dx = (subject_ptr->x > um_ptr->fx) ? (subject_ptr->x - um_ptr->fx) : (um_ptr->fx - subject_ptr->x);
+    monster_type *m_ptr = &subject_ptr->current_floor_ptr->m_list[m_idx];
+    int dy = (subject_ptr->y > m_ptr->fy) ? (subject_ptr->y - m_ptr->fy) : (m_ptr->fy - subject_ptr->y);
+    int dx = (subject_ptr->x > m_ptr->fx) ? (subject_ptr->x - m_ptr->fx) : (m_ptr->fx - subject_ptr->x);
     POSITION distance = (dy > dx) ? (dy + (dx >> 1)) : (dx + (dy >> 1));
     if (distance > 255)
         distance = 255;
@@ -186,10 +191,21 @@ static POSITION decide_updated_distance(player_type *subject_ptr, um_type *um_pt
     if (!distance)
         distance = 1;
 
-    um_ptr->m_ptr->cdis = distance;
+    m_ptr->cdis = distance;
+    if (distance < AAF_LIMIT)
+        set_monster_active(subject_ptr->current_floor_ptr, m_idx);
+
     return distance;
 }
 
+static POSITION decide_updated_distance(player_type *subject_ptr, um_type *um_ptr, MONSTER_IDX m_idx)
+{
+    if (!um_ptr->full)
+        return um_ptr->m_ptr->cdis;
+
+    return update_monster_distance(subject_ptr, m_idx);
+}
+
 static void update_smart_stupid_flags(monster_race *r_ptr)
 {
     if (r_ptr->flags2 & RF2_SMART)
@@ -370,7 +386,7 @@ static bool check_invisible(player_type *subject_ptr, um_type *um_ptr)
  */
 static void decide_sight_invisible_monster(player_type *subject_ptr, um_type *um_ptr, MONSTER_IDX m_idx)
 {
-    POSITION distance = decide_updated_distance(subject_ptr, um_ptr);
+    POSITION distance = decide_updated_distance(subject_ptr, um_ptr, m_idx);
     monster_race *r_ptr = &r_info[um_ptr->m_ptr->r_idx];
     if (distance > (um_ptr->in_darkness ? MAX_SIGHT / 2 : MAX_SIGHT))
         return;
@@ -507,6 +523,27 @@ void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
         disturb(subject_ptr, TRUE, TRUE);
 }
 
+/*!
+ * @brief 感知範囲外にいて見えていないモンスターの距離だけを更新する
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param m_idx モンスターID
+ * @param full 距離更新を行うならtrue
+ * @param sight 感知できる最大距離
+ * @return update_monster() を呼ぶ必要がなければTRUE
+ * @details
+ * 視認・感知済みでなく、MFLAG2_MARK も MFLAG_VIEW も立っていないモンスターが
+ * 感知範囲の外にいるなら、update_monster() は距離の更新以外何もしない。
+ */
+static bool update_distant_monster(player_type *player_ptr, MONSTER_IDX m_idx, bool full, POSITION sight)
+{
+    monster_type *m_ptr = &player_ptr->current_floor_ptr->m_list[m_idx];
+    if (m_ptr->ml || (m_ptr->mflag & MFLAG_VIEW) || (m_ptr->mflag2 & MFLAG2_MARK))
+        return FALSE;
+
+    POSITION distance = full ? update_monster_distance(player_ptr, m_idx) : m_ptr->cdis;
+    return distance > sight;
+}
+
 /*!
  * todo モンスターの感知状況しか更新していないように見える。関数名変更を検討する
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -517,11 +554,16 @@ void update_monster(player_type *subject_ptr, MONSTER_IDX m_idx, bool full)
 void update_monsters(player_type *player_ptr, bool full)
 {
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    bool in_darkness = (d_info[player_ptr->dungeon_idx].flags1 & DF1_DARKNESS) && !player_ptr->see_nocto;
+    POSITION sight = in_darkness ? MAX_SIGHT / 2 : MAX_SIGHT;
     for (MONSTER_IDX i = 1; i < floor_ptr->m_max; i++) {
         monster_type *m_ptr = &floor_ptr->m_list[i];
         if (!monster_is_valid(m_ptr))
             continue;
 
+        if (update_distant_monster(player_ptr, i, full, sight))
+            continue;
+
         update_monster(player_ptr, i, full);
     }
 }
@@ -44,6 +44,29 @@ int chameleon_change_m_idx = 0;
  */
 summon_type summon_specific_type = SUMMON_NONE;
 
+/* get_mon_num_prep() の判定結果を記憶する条件の数 / Number of remembered results of get_mon_num_prep() */
+#define MON_NUM_PREP_CACHE_MAX 4
+
+#define MON_NUM_PREP_ALLOWED 0x01 /*!< 第2次候補になる / The race passes the hooks and restrictions */
+#define MON_NUM_PREP_SCALED 0x02 /*!< ダンジョンの出現制限に合わないので確率を減らす / The race is thinned out by "special_div" */
+
+/*!
+ * @brief get_mon_num_prep() の判定結果と、それを求めた条件 / Remembered eligibility of the races
+ */
+typedef struct mon_num_prep_cache_type {
+    monsterrace_hook_type monster_hook;
+    monsterrace_hook_type monster_hook2;
+    DUNGEON_IDX dungeon_idx;
+    DEPTH dun_level;
+    bool phase_out;
+    bool chameleon;
+    summon_type summon;
+    byte *flags; /*!< 種族ごとの MON_NUM_PREP_* [alloc_race_size] */
+} mon_num_prep_cache_type;
+
+static mon_num_prep_cache_type mon_num_prep_cache[MON_NUM_PREP_CACHE_MAX];
+static int mon_num_prep_cache_next = 0;
+
 /*!
  * @brief 指定されたモンスター種族がダンジョンの制限にかかるかどうかをチェックする / Some dungeon types restrict the possible monsters.
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -314,6 +337,120 @@ monsterrace_hook_type get_monster_hook2(player_type *player_ptr, POSITION y, POS
     return (monsterrace_hook_type)mon_hook_floor;
 }
 
+/*!
+ * @brief 抽選対象の判定結果が前提条件だけで決まるフックかどうかを返す
+ * @param hook 生成制限関数
+ * @return 種族とダンジョンだけで結果が決まるならばTRUE
+ * @details
+ * 召喚者や部屋の種類など、引数以外の状態を見るフックは記憶できない。
+ */
+static bool is_mon_num_prep_cacheable(monsterrace_hook_type hook)
+{
+    static const monsterrace_hook_type cacheable_hooks[] = {
+        (monsterrace_hook_type)mon_hook_dungeon,
+        (monsterrace_hook_type)mon_hook_town,
+        (monsterrace_hook_type)mon_hook_ocean,
+        (monsterrace_hook_type)mon_hook_shore,
+        (monsterrace_hook_type)mon_hook_waste,
+        (monsterrace_hook_type)mon_hook_grass,
+        (monsterrace_hook_type)mon_hook_wood,
+        (monsterrace_hook_type)mon_hook_volcano,
+        (monsterrace_hook_type)mon_hook_mountain,
+        (monsterrace_hook_type)mon_hook_deep_water,
+        (monsterrace_hook_type)mon_hook_shallow_water,
+        (monsterrace_hook_type)mon_hook_lava,
+        (monsterrace_hook_type)mon_hook_floor,
+    };
+
+    if (hook == NULL)
+        return TRUE;
+
+    for (size_t i = 0; i < sizeof(cacheable_hooks) / sizeof(cacheable_hooks[0]); i++) {
+        if (hook == cacheable_hooks[i])
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+/*!
+ * @brief 種族が第2次候補になるかを判定する
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param entry 判定する生成テーブルのエントリ
+ * @param monster_hook 制限関数1
+ * @param monster_hook2 制限関数2
+ * @return MON_NUM_PREP_* の組み合わせ
+ * @details
+ * クエストの進行で変わる RF1_QUESTOR はここでは見ず、get_mon_num_prep() で毎回判定する。
+ */
+static byte decide_mon_num_prep(player_type *player_ptr, alloc_entry *entry, monsterrace_hook_type monster_hook, monsterrace_hook_type monster_hook2)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    monster_race *r_ptr = &r_info[entry->index];
+    if (((monster_hook != NULL) && !((*monster_hook)(player_ptr, entry->index)))
+        || ((monster_hook2 != NULL) && !((*monster_hook2)(player_ptr, entry->index))))
+        return 0;
+
+    if (!player_ptr->phase_out && !chameleon_change_m_idx && summon_specific_type != SUMMON_GUARDIANS) {
+        if (r_ptr->flags7 & RF7_GUARDIAN)
+            return 0;
+
+        if (((r_ptr->flags1 & RF1_FORCE_DEPTH) != 0) && (r_ptr->level > floor_ptr->dun_level))
+            return 0;
+    }
+
+    if (entry->prob1 <= 0)
+        return 0;
+
+    if (restrict_monster_to_dungeon(player_ptr, entry->index))
+        return MON_NUM_PREP_ALLOWED;
+
+    return MON_NUM_PREP_ALLOWED | MON_NUM_PREP_SCALED;
+}
+
+/*!
+ * @brief 記憶しておいた第2次候補の判定結果を探す
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param monster_hook 制限関数1
+ * @param monster_hook2 制限関数2
+ * @return 種族ごとの判定結果の配列。記憶できない条件ならばNULL
+ * @details
+ * 判定結果はフックとダンジョン、階層、召喚条件などだけで決まるので、
+ * 同じ条件で呼ばれた時は全種族に対するフック呼び出しを省略できる。
+ */
+static byte *find_mon_num_prep_cache(player_type *player_ptr, monsterrace_hook_type monster_hook, monsterrace_hook_type monster_hook2)
+{
+    if (!is_mon_num_prep_cacheable(monster_hook) || !is_mon_num_prep_cacheable(monster_hook2))
+        return NULL;
+
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    for (int i = 0; i < MON_NUM_PREP_CACHE_MAX; i++) {
+        mon_num_prep_cache_type *cache_ptr = &mon_num_prep_cache[i];
+        if (cache_ptr->flags && (cache_ptr->monster_hook == monster_hook) && (cache_ptr->monster_hook2 == monster_hook2)
+            && (cache_ptr->dungeon_idx == player_ptr->dungeon_idx) && (cache_ptr->dun_level == floor_ptr->dun_level)
+            && (cache_ptr->phase_out == player_ptr->phase_out) && (cache_ptr->chameleon == (chameleon_change_m_idx != 0))
+            && (cache_ptr->summon == summon_specific_type))
+            return cache_ptr->flags;
+    }
+
+    mon_num_prep_cache_type *cache_ptr = &mon_num_prep_cache[mon_num_prep_cache_next];
+    mon_num_prep_cache_next = (mon_num_prep_cache_next + 1) % MON_NUM_PREP_CACHE_MAX;
+    if (!cache_ptr->flags)
+        C_MAKE(cache_ptr->flags, alloc_race_size, byte);
+
+    cache_ptr->monster_hook = monster_hook;
+    cache_ptr->monster_hook2 = monster_hook2;
+    cache_ptr->dungeon_idx = player_ptr->dungeon_idx;
+    cache_ptr->dun_level = floor_ptr->dun_level;
+    cache_ptr->phase_out = player_ptr->phase_out;
+    cache_ptr->chameleon = chameleon_change_m_idx != 0;
+    cache_ptr->summon = summon_specific_type;
+    for (int i = 0; i < alloc_race_size; i++)
+        cache_ptr->flags[i] = decide_mon_num_prep(player_ptr, &alloc_race_table[i], monster_hook, monster_hook2);
+
+    return cache_ptr->flags;
+}
+
 /*!
  * @brief モンスター生成制限関数最大2つから / Apply a "monster restriction function" to the "monster allocation table"
  * @param player_ptr プレーヤーへの参照ポインタ
@@ -328,26 +465,17 @@ errr get_mon_num_prep(player_type *player_ptr, monsterrace_hook_type monster_hoo
     DEPTH lev_max = 0;
     int total = 0;
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    byte *prep_flags = find_mon_num_prep_cache(player_ptr, monster_hook, monster_hook2);
+    bool scale = floor_ptr->dun_level && (!floor_ptr->inside_quest || is_fixed_quest_idx(floor_ptr->inside_quest)) && !player_ptr->phase_out;
+    bool exclude_questor = !player_ptr->phase_out && !chameleon_change_m_idx && summon_specific_type != SUMMON_GUARDIANS;
     for (int i = 0; i < alloc_race_size; i++) {
         alloc_entry *entry = &alloc_race_table[i];
         entry->prob2 = 0;
-        monster_race *r_ptr = &r_info[entry->index];
-        if (((monster_hook != NULL) && !((*monster_hook)(player_ptr, entry->index)))
-            || ((monster_hook2 != NULL) && !((*monster_hook2)(player_ptr, entry->index))))
+        byte flags = prep_flags ? prep_flags[i] : decide_mon_num_prep(player_ptr, entry, monster_hook, monster_hook2);
+        if (!(flags & MON_NUM_PREP_ALLOWED))
             continue;
 
-        if (!player_ptr->phase_out && !chameleon_change_m_idx && summon_specific_type != SUMMON_GUARDIANS) {
-            if (r_ptr->flags1 & RF1_QUESTOR)
-                continue;
-
-            if (r_ptr->flags7 & RF7_GUARDIAN)
-                continue;
-
-            if (((r_ptr->flags1 & RF1_FORCE_DEPTH) != 0) && (r_ptr->level > floor_ptr->dun_level))
-                continue;
-        }
-
-        if (entry->prob1 <= 0)
+        if (exclude_questor && (r_info[entry->index].flags1 & RF1_QUESTOR))
             continue;
 
         mon_num++;
@@ -357,8 +485,7 @@ errr get_mon_num_prep(player_type *player_ptr, monsterrace_hook_type monster_hoo
             lev_max = entry->level;
 
         entry->prob2 = entry->prob1;
-        if (floor_ptr->dun_level && (!floor_ptr->inside_quest || is_fixed_quest_idx(floor_ptr->inside_quest))
-            && !restrict_monster_to_dungeon(player_ptr, entry->index) && !player_ptr->phase_out) {
+        if (scale && (flags & MON_NUM_PREP_SCALED)) {
             int hoge = entry->prob2 * d_info[player_ptr->dungeon_idx].special_div;
             entry->prob2 = hoge / 64;
             if (randint0(64) < (hoge & 0x3f))
@@ -130,8 +130,8 @@ bool move_player_effect(player_type *creature_ptr, POSITION ny, POSITION nx, BIT
         creature_ptr->y = ny;
         creature_ptr->x = nx;
         if (!(mpe_mode & MPE_DONT_SWAP_MON)) {
-            g_ptr->m_idx = om_idx;
-            oc_ptr->m_idx = nm_idx;
+            set_cave_monster(floor_ptr, ny, nx, om_idx);
+            set_cave_monster(floor_ptr, oy, ox, nm_idx);
             if (om_idx > 0) {
                 monster_type *om_ptr = &floor_ptr->m_list[om_idx];
                 om_ptr->fy = ny;
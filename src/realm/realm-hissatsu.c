@@ -365,8 +365,8 @@ concptr do_hissatsu_spell(player_type *caster_ptr, SPELL_IDX spell, spell_type m
                 }
                 if ((ty != oy) || (tx != ox)) {
                     msg_format(_("%sを吹き飛ばした！", "You blow %s away!"), m_name);
-                    caster_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = 0;
-                    caster_ptr->current_floor_ptr->grid_array[ty][tx].m_idx = m_idx;
+                    set_cave_monster(caster_ptr->current_floor_ptr, oy, ox, 0);
+                    set_cave_monster(caster_ptr->current_floor_ptr, ty, tx, m_idx);
                     m_ptr->fy = ty;
                     m_ptr->fx = tx;
 
@@ -744,8 +744,8 @@ concptr do_hissatsu_spell(player_type *caster_ptr, SPELL_IDX spell, spell_type m
                     continue;
                 }
 
-                g_ptr->m_idx = 0;
-                caster_ptr->current_floor_ptr->grid_array[ny][nx].m_idx = m_idx;
+                set_cave_monster(caster_ptr->current_floor_ptr, y, x, 0);
+                set_cave_monster(caster_ptr->current_floor_ptr, ny, nx, m_idx);
                 m_ptr->fy = ny;
                 m_ptr->fx = nx;
 
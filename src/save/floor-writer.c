@@ -18,6 +18,20 @@
 #include "util/angband-files.h"
 #include "util/sort.h"
 
+/*!
+ * @brief gridテンプレート検索用のハッシュ値を計算する / Hash the fields a grid template is made of
+ * @param g_ptr グリッドへの参照ポインタ
+ * @return ハッシュ値
+ */
+static u32b hash_grid_template(grid_type *g_ptr)
+{
+    u32b hash = (u32b)g_ptr->info * 0x9E3779B1UL;
+    hash ^= (u32b)(u16b)g_ptr->feat * 0x85EBCA77UL;
+    hash ^= (u32b)(u16b)g_ptr->mimic * 0xC2B2AE3DUL;
+    hash ^= (u32b)(u16b)g_ptr->special * 0x27D4EB2FUL;
+    return hash ^ (hash >> 15);
+}
+
 /*!
  * @brief 保存フロアの書き込み / Actually write a saved floor data using effectively compressed format.
  * @param sf_ptr 保存したいフロアの参照ポインタ
@@ -63,20 +77,37 @@ void wr_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
     grid_template_type *templates;
     C_MAKE(templates, max_num_temp, grid_template_type);
     u16b num_temp = 0;
+
+    /* Template ID of each grid, and a hash table from grid contents to (template ID + 1) */
+    int num_grids = floor_ptr->height * floor_ptr->width;
+    u16b *grid_temp;
+    C_MAKE(grid_temp, num_grids, u16b);
+    u32b hash_size = 1;
+    while (hash_size < (u32b)num_grids * 2)
+        hash_size <<= 1;
+
+    u16b *hash_table;
+    C_MAKE(hash_table, hash_size, u16b);
     for (int y = 0; y < floor_ptr->height; y++) {
         for (int x = 0; x < floor_ptr->width; x++) {
             grid_type *g_ptr = &floor_ptr->grid_array[y][x];
-            int i;
-            for (i = 0; i < num_temp; i++) {
-                if (templates[i].info == g_ptr->info && templates[i].feat == g_ptr->feat && templates[i].mimic == g_ptr->mimic
-                    && templates[i].special == g_ptr->special) {
-                    templates[i].occurrence++;
+            u32b slot = hash_grid_template(g_ptr) & (hash_size - 1);
+            int i = -1;
+            while (hash_table[slot]) {
+                grid_template_type *ct_ptr = &templates[hash_table[slot] - 1];
+                if (ct_ptr->info == g_ptr->info && ct_ptr->feat == g_ptr->feat && ct_ptr->mimic == g_ptr->mimic && ct_ptr->special == g_ptr->special) {
+                    i = hash_table[slot] - 1;
                     break;
                 }
+
+                slot = (slot + 1) & (hash_size - 1);
             }
 
-            if (i < num_temp)
+            if (i >= 0) {
+                templates[i].occurrence++;
+                grid_temp[y * floor_ptr->width + x] = (u16b)i;
                 continue;
+            }
 
             if (num_temp >= max_num_temp) {
                 grid_template_type *old_template = templates;
@@ -91,17 +122,25 @@ void wr_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
             templates[num_temp].mimic = g_ptr->mimic;
             templates[num_temp].special = g_ptr->special;
             templates[num_temp].occurrence = 1;
+            templates[num_temp].index = num_temp;
+            hash_table[slot] = num_temp + 1;
+            grid_temp[y * floor_ptr->width + x] = num_temp;
             num_temp++;
         }
     }
 
+    C_KILL(hash_table, hash_size, u16b);
+
     int dummy_why;
     ang_sort(player_ptr, templates, &dummy_why, num_temp, ang_sort_comp_cave_temp, ang_sort_swap_cave_temp);
 
     /*** Dump templates ***/
+    u16b *sorted_temp;
+    C_MAKE(sorted_temp, num_temp, u16b);
     wr_u16b(num_temp);
     for (int i = 0; i < num_temp; i++) {
         grid_template_type *ct_ptr = &templates[i];
+        sorted_temp[ct_ptr->index] = (u16b)i;
         wr_u16b((u16b)ct_ptr->info);
         wr_s16b(ct_ptr->feat);
         wr_s16b(ct_ptr->mimic);
@@ -110,32 +149,22 @@ void wr_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
 
     byte count = 0;
     u16b prev_u16b = 0;
-    for (int y = 0; y < floor_ptr->height; y++) {
-        for (int x = 0; x < floor_ptr->width; x++) {
-            grid_type *g_ptr = &floor_ptr->grid_array[y][x];
-            int i;
-            for (i = 0; i < num_temp; i++) {
-                if (templates[i].info == g_ptr->info && templates[i].feat == g_ptr->feat && templates[i].mimic == g_ptr->mimic
-                    && templates[i].special == g_ptr->special)
-                    break;
-            }
-
-            u16b tmp16u = (u16b)i;
-            if ((tmp16u == prev_u16b) && (count != MAX_UCHAR)) {
-                count++;
-                continue;
-            }
-
-            wr_byte((byte)count);
-            while (prev_u16b >= MAX_UCHAR) {
-                wr_byte(MAX_UCHAR);
-                prev_u16b -= MAX_UCHAR;
-            }
+    for (int i = 0; i < num_grids; i++) {
+        u16b tmp16u = sorted_temp[grid_temp[i]];
+        if ((tmp16u == prev_u16b) && (count != MAX_UCHAR)) {
+            count++;
+            continue;
+        }
 
-            wr_byte((byte)prev_u16b);
-            prev_u16b = tmp16u;
-            count = 1;
+        wr_byte((byte)count);
+        while (prev_u16b >= MAX_UCHAR) {
+            wr_byte(MAX_UCHAR);
+            prev_u16b -= MAX_UCHAR;
         }
+
+        wr_byte((byte)prev_u16b);
+        prev_u16b = tmp16u;
+        count = 1;
     }
 
     if (count > 0) {
@@ -148,6 +177,8 @@ void wr_saved_floor(player_type *player_ptr, saved_floor_type *sf_ptr)
         wr_byte((byte)prev_u16b);
     }
 
+    C_KILL(sorted_temp, num_temp, u16b);
+    C_KILL(grid_temp, num_grids, u16b);
     C_KILL(templates, max_num_temp, grid_template_type);
 
     /*** Dump objects ***/
@@ -244,6 +275,9 @@ static bool save_floor_aux(player_type *player_ptr, saved_floor_type *sf_ptr)
     wr_u32b(v_stamp);
     wr_u32b(x_stamp);
 
+    if (!flush_savefile())
+        return FALSE;
+
     return !ferror(saving_savefile) && (fflush(saving_savefile) != EOF);
 }
 /*!
@@ -262,6 +296,7 @@ bool save_floor(player_type *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mod
 
     char floor_savefile[1024];
     if ((mode & SLF_SECOND) != 0) {
+        (void)flush_savefile();
         old_fff = saving_savefile;
         old_xor_byte = save_xor_byte;
         old_v_stamp = v_stamp;
@@ -287,6 +322,9 @@ bool save_floor(player_type *player_ptr, saved_floor_type *sf_ptr, BIT_FLAGS mod
             if (save_floor_aux(player_ptr, sf_ptr))
                 is_save_successful = TRUE;
 
+            if (!flush_savefile())
+                is_save_successful = FALSE;
+
             if (angband_fclose(saving_savefile))
                 is_save_successful = FALSE;
         }
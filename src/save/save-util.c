@@ -5,6 +5,92 @@ byte save_xor_byte; /* Simple encryption */
 u32b v_stamp = 0L; /* A simple "checksum" on the actual values */
 u32b x_stamp = 0L; /* A simple "checksum" on the encoded bytes */
 
+/* Encoded bytes not yet written to saving_savefile */
+static byte save_buffer[SAVEFILE_BUFFER_SIZE];
+static size_t save_buffer_len = 0;
+
+/* Image of the savefile built in memory while saving_savefile is NULL */
+static byte *save_snapshot = NULL;
+static size_t save_snapshot_len = 0;
+static size_t save_snapshot_size = 0;
+
+/*!
+ * @brief メモリ上のセーブデータ末尾にバイト列を追加する / Append bytes to the in-memory savefile image
+ * @param data 追加するバイト列
+ * @param len バイト数
+ * @return なし
+ */
+static void append_savefile_snapshot(const byte *data, size_t len)
+{
+    if (save_snapshot_len + len > save_snapshot_size) {
+        size_t size = save_snapshot_size ? save_snapshot_size : SAVEFILE_BUFFER_SIZE * 16;
+        while (size < save_snapshot_len + len)
+            size *= 2;
+
+        byte *snapshot;
+        C_MAKE(snapshot, size, byte);
+        if (save_snapshot) {
+            (void)memcpy(snapshot, save_snapshot, save_snapshot_len);
+            C_KILL(save_snapshot, save_snapshot_size, byte);
+        }
+
+        save_snapshot = snapshot;
+        save_snapshot_size = size;
+    }
+
+    (void)memcpy(save_snapshot + save_snapshot_len, data, len);
+    save_snapshot_len += len;
+}
+
+/*!
+ * @brief セーブデータの書き出し先をメモリ上に切り替える / Start building the savefile image in memory
+ * @return なし
+ * @details
+ * saving_savefile を NULL にしている間の書き込みがメモリ上に溜められる。
+ * 領域は次の呼び出しで再利用されるので、前回の内容を使い終えてから呼ぶこと。
+ */
+void begin_savefile_snapshot(void)
+{
+    saving_savefile = NULL;
+    save_buffer_len = 0;
+    save_snapshot_len = 0;
+}
+
+/*!
+ * @brief メモリ上に作ったセーブデータを取得する / Get the savefile image built in memory
+ * @param len バイト数を返す参照ポインタ
+ * @return セーブデータの先頭
+ */
+byte *get_savefile_snapshot(size_t *len)
+{
+    (void)flush_savefile();
+    *len = save_snapshot_len;
+    return save_snapshot;
+}
+
+/*!
+ * @brief 溜めておいたバイト列をファイルに書き出す / Write out the buffered bytes of the savefile
+ * @return 書き込みに成功したらTRUE
+ * @details
+ * saving_savefile を閉じたり差し替えたりする前に必ず呼ぶこと。
+ * 溜まっているバイトがなければファイルには触れない。
+ * saving_savefile が NULL ならメモリ上のセーブデータに追加する。
+ */
+bool flush_savefile(void)
+{
+    if (save_buffer_len == 0)
+        return TRUE;
+
+    size_t len = save_buffer_len;
+    save_buffer_len = 0;
+    if (!saving_savefile) {
+        append_savefile_snapshot(save_buffer, len);
+        return TRUE;
+    }
+
+    return fwrite(save_buffer, 1, len, saving_savefile) == len;
+}
+
 /*!
  * @brief 1バイトをファイルに書き込む / These functions place information into a savefile a byte at a time
  * @param v 書き込むバイト値
@@ -12,9 +98,11 @@ u32b x_stamp = 0L; /* A simple "checksum" on the encoded bytes */
  */
 static void sf_put(byte v)
 {
-    /* Encode the value, write a character */
+    /* Encode the value, buffer a character */
     save_xor_byte ^= v;
-    (void)putc((int)save_xor_byte, saving_savefile);
+    save_buffer[save_buffer_len++] = save_xor_byte;
+    if (save_buffer_len == SAVEFILE_BUFFER_SIZE)
+        (void)flush_savefile();
 
     /* Maintain the checksum info */
     v_stamp += v;
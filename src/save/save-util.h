@@ -2,11 +2,17 @@
 
 #include "system/angband.h"
 
+/* Size of the buffer between the savefile codec and stdio */
+#define SAVEFILE_BUFFER_SIZE 65536
+
 extern FILE *saving_savefile;
 extern byte save_xor_byte;
 extern u32b v_stamp;
 extern u32b x_stamp;
 
+bool flush_savefile(void);
+void begin_savefile_snapshot(void);
+byte *get_savefile_snapshot(size_t *len);
 void wr_byte(byte v);
 void wr_u16b(u16b v);
 void wr_s16b(s16b v);
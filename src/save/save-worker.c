@@ -0,0 +1,162 @@
+﻿/*!
+ * @file save-worker.c
+ * @brief メモリ上に作ったセーブデータを別スレッドでファイルに書き出す / Write a savefile image to disk in a background thread
+ * @details
+ * スレッドが使えない環境では start_save_worker() の中で書き込みを済ませる。
+ * 書き込み中のデータは次の begin_savefile_snapshot() まで変更しないこと。
+ */
+
+#include "save/save-worker.h"
+#include "util/angband-files.h"
+#ifdef WINDOWS
+#include <windows.h>
+#elif defined(HAVE_PTHREAD)
+#include <pthread.h>
+#endif
+#if defined(HAVE_FSYNC) && defined(HAVE_UNISTD_H)
+#include <unistd.h>
+#endif
+
+typedef struct save_job_type {
+    FILE *fff; /*!< 書き込み先 (書き込み後に閉じる) */
+    const byte *data; /*!< 書き込むデータ */
+    size_t len; /*!< 書き込むバイト数 */
+    bool active; /*!< 結果を受け取っていない書き込みがある */
+    bool threaded; /*!< 別スレッドで書き込み中 */
+    bool finished; /*!< 書き込みが終わった */
+    bool result; /*!< 書き込みに成功した */
+} save_job_type;
+
+static save_job_type save_job;
+
+#ifdef WINDOWS
+static HANDLE save_thread;
+#elif defined(HAVE_PTHREAD)
+static pthread_t save_thread;
+static pthread_mutex_t save_job_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/*!
+ * @brief セーブデータをファイルに書き出して閉じる / Write the savefile image and close the file
+ * @param job 書き込み内容
+ * @return 成功すればTRUE
+ */
+static bool write_save_job(save_job_type *job)
+{
+    bool result = fwrite(job->data, 1, job->len, job->fff) == job->len;
+    result = result && (fflush(job->fff) != EOF);
+#if defined(HAVE_FSYNC) && defined(HAVE_UNISTD_H)
+    result = result && (fsync(fileno(job->fff)) == 0);
+#endif
+    if (angband_fclose(job->fff))
+        result = FALSE;
+
+    return result;
+}
+
+#ifdef WINDOWS
+static DWORD WINAPI save_worker_main(LPVOID arg)
+{
+    (void)arg;
+    save_job.result = write_save_job(&save_job);
+    return 0;
+}
+
+/*!
+ * @brief 書き込みスレッドの終了を確認する / Check whether the writer thread has finished
+ * @param wait 終わるまで待つならTRUE
+ * @return 終わっていればTRUE
+ */
+static bool join_save_thread(bool wait)
+{
+    if (WaitForSingleObject(save_thread, wait ? INFINITE : 0) != WAIT_OBJECT_0)
+        return FALSE;
+
+    CloseHandle(save_thread);
+    return TRUE;
+}
+#elif defined(HAVE_PTHREAD)
+static void *save_worker_main(void *arg)
+{
+    (void)arg;
+    bool result = write_save_job(&save_job);
+    pthread_mutex_lock(&save_job_mutex);
+    save_job.result = result;
+    save_job.finished = TRUE;
+    pthread_mutex_unlock(&save_job_mutex);
+    return NULL;
+}
+
+/*!
+ * @brief 書き込みスレッドの終了を確認する / Check whether the writer thread has finished
+ * @param wait 終わるまで待つならTRUE
+ * @return 終わっていればTRUE
+ */
+static bool join_save_thread(bool wait)
+{
+    if (!wait) {
+        pthread_mutex_lock(&save_job_mutex);
+        bool finished = save_job.finished;
+        pthread_mutex_unlock(&save_job_mutex);
+        if (!finished)
+            return FALSE;
+    }
+
+    pthread_join(save_thread, NULL);
+    return TRUE;
+}
+#endif
+
+/*!
+ * @brief セーブデータの書き込みを開始する / Start writing a savefile image
+ * @param fff 書き込み先 (書き込み後に閉じられる)
+ * @param data 書き込むデータ
+ * @param len 書き込むバイト数
+ * @return なし
+ * @details
+ * 前回の書き込みの結果を poll_save_worker() で受け取ってから呼ぶこと。
+ */
+void start_save_worker(FILE *fff, const byte *data, size_t len)
+{
+    save_job.fff = fff;
+    save_job.data = data;
+    save_job.len = len;
+    save_job.active = TRUE;
+    save_job.finished = FALSE;
+    save_job.result = FALSE;
+
+#ifdef WINDOWS
+    save_thread = CreateThread(NULL, 0, save_worker_main, NULL, 0, NULL);
+    save_job.threaded = save_thread != NULL;
+#elif defined(HAVE_PTHREAD)
+    save_job.threaded = pthread_create(&save_thread, NULL, save_worker_main, NULL) == 0;
+#else
+    save_job.threaded = FALSE;
+#endif
+    if (save_job.threaded)
+        return;
+
+    save_job.result = write_save_job(&save_job);
+    save_job.finished = TRUE;
+}
+
+/*!
+ * @brief セーブデータの書き込み結果を受け取る / Collect the result of writing a savefile image
+ * @param wait 書き込み中なら終わるまで待つ
+ * @return 書き込みの状態
+ * @details
+ * SAVE_WORKER_DONE / SAVE_WORKER_FAILED は一度だけ返し、以降は SAVE_WORKER_IDLE を返す。
+ */
+save_worker_status poll_save_worker(bool wait)
+{
+    if (!save_job.active)
+        return SAVE_WORKER_IDLE;
+
+#if defined(WINDOWS) || defined(HAVE_PTHREAD)
+    if (save_job.threaded && !join_save_thread(wait))
+        return SAVE_WORKER_BUSY;
+#endif
+
+    save_job.active = FALSE;
+    return save_job.result ? SAVE_WORKER_DONE : SAVE_WORKER_FAILED;
+}
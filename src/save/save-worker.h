@@ -0,0 +1,16 @@
+﻿#pragma once
+
+#include "system/angband.h"
+
+/*!
+ * @brief バックグラウンド書き込みの状態
+ */
+typedef enum save_worker_status {
+    SAVE_WORKER_IDLE = 0, /*!< 書き込むデータがない */
+    SAVE_WORKER_BUSY = 1, /*!< 書き込み中 */
+    SAVE_WORKER_DONE = 2, /*!< 書き込みに成功した */
+    SAVE_WORKER_FAILED = 3, /*!< 書き込みに失敗した */
+} save_worker_status;
+
+void start_save_worker(FILE *fff, const byte *data, size_t len);
+save_worker_status poll_save_worker(bool wait);
@@ -31,6 +31,7 @@
 #include "save/monster-writer.h"
 #include "save/player-writer.h"
 #include "save/save-util.h"
+#include "save/save-worker.h"
 #include "store/store-owners.h"
 #include "store/store-util.h"
 #include "system/angband-version.h"
@@ -39,6 +40,9 @@
 #include "view/display-messages.h"
 #include "world/world.h"
 
+/* Play time recorded by the background save in progress */
+static u32b background_save_play_time;
+
 /*!
  * @brief セーブデータの書き込み /
  * Actually write a save-file
@@ -213,6 +217,12 @@ static bool wr_savefile_new(player_type *player_ptr, save_type type)
 
     wr_u32b(v_stamp);
     wr_u32b(x_stamp);
+    if (!flush_savefile())
+        return FALSE;
+
+    if (!saving_savefile)
+        return TRUE;
+
     return !ferror(saving_savefile) && (fflush(saving_savefile) != EOF);
 }
 
@@ -242,6 +252,9 @@ static bool save_player_aux(player_type *player_ptr, char *name, save_type type)
             if (wr_savefile_new(player_ptr, type))
                 is_save_successful = TRUE;
 
+            if (!flush_savefile())
+                is_save_successful = FALSE;
+
             if (angband_fclose(saving_savefile))
                 is_save_successful = FALSE;
         }
@@ -261,14 +274,120 @@ static bool save_player_aux(player_type *player_ptr, char *name, save_type type)
     return TRUE;
 }
 
+/*!
+ * @brief セーブデータをメモリ上に作り、ファイルへの書き込みを別スレッドに任せる /
+ * Serialize the player into memory and leave writing it out to the background writer
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param name 書き込み先のファイル名
+ * @return 書き込みを始められればtrue
+ * @details
+ * 書き込みの結果は finish_background_save() で受け取る。
+ */
+static bool save_player_background(player_type *player_ptr, char *name)
+{
+    safe_setuid_grab(player_ptr);
+    int file_permission = 0644;
+    int fd = fd_make(name, file_permission);
+    safe_setuid_drop();
+    if (fd < 0)
+        return FALSE;
+
+    (void)fd_close(fd);
+    safe_setuid_grab(player_ptr);
+    FILE *fff = angband_fopen(name, "wb");
+    safe_setuid_drop();
+
+    begin_savefile_snapshot();
+    if (!fff || !wr_savefile_new(player_ptr, SAVE_TYPE_BACKGROUND)) {
+        (void)angband_fclose(fff);
+        safe_setuid_grab(player_ptr);
+        (void)fd_kill(name);
+        safe_setuid_drop();
+        return FALSE;
+    }
+
+    size_t len;
+    byte *data = get_savefile_snapshot(&len);
+    background_save_play_time = current_world_ptr->play_time;
+    start_save_worker(fff, data, len);
+    return TRUE;
+}
+
+/*!
+ * @brief 書き終えたセーブデータを本来のセーブファイルと差し替える /
+ * Replace the savefile with the newly written one
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param safe 書き終えたファイル名
+ * @param type セーブ後の処理種類
+ * @return なし
+ */
+static void replace_savefile(player_type *player_ptr, concptr safe, save_type type)
+{
+    char temp[1024];
+    char filename[1024];
+    strcpy(temp, savefile);
+    strcat(temp, ".old");
+    safe_setuid_grab(player_ptr);
+    fd_kill(temp);
+
+    if (type == SAVE_TYPE_DEBUG)
+        strcpy(filename, debug_savefile);
+    if (type != SAVE_TYPE_DEBUG)
+        strcpy(filename, savefile);
+
+    fd_move(filename, temp);
+    fd_move(safe, filename);
+    fd_kill(temp);
+    safe_setuid_drop();
+    current_world_ptr->character_loaded = TRUE;
+}
+
+/*!
+ * @brief バックグラウンドでのセーブの結果を受け取る /
+ * Collect the result of a background save
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param wait 書き込み中なら終わるまで待つ
+ * @return なし
+ * @details
+ * 書き込みに成功していればセーブファイルを差し替え、失敗していればメッセージで知らせる。
+ * 待つのはこの後で同期的にセーブし直す場合なので、その時は失敗を知らせない。
+ */
+void finish_background_save(player_type *player_ptr, bool wait)
+{
+    save_worker_status status = poll_save_worker(wait);
+    if ((status == SAVE_WORKER_IDLE) || (status == SAVE_WORKER_BUSY))
+        return;
+
+    char safe[1024];
+    strcpy(safe, savefile);
+    strcat(safe, ".new");
+    if (status == SAVE_WORKER_FAILED) {
+        safe_setuid_grab(player_ptr);
+        (void)fd_kill(safe);
+        safe_setuid_drop();
+        if (!wait)
+            msg_print(_("自動セーブに失敗しました！", "Autosave failed!"));
+
+        return;
+    }
+
+    replace_savefile(player_ptr, safe, SAVE_TYPE_BACKGROUND);
+    counts_write(player_ptr, 0, background_save_play_time);
+    current_world_ptr->character_saved = TRUE;
+}
+
 /*!
  * @brief セーブデータ書き込みのメインルーチン /
  * Attempt to save the player in a savefile
  * @param player_ptr プレーヤーへの参照ポインタ
  * @return 成功すればtrue
+ * @details
+ * SAVE_TYPE_BACKGROUND の場合はファイルへの書き込みを始めた時点で戻る。
  */
 bool save_player(player_type *player_ptr, save_type type)
 {
+    finish_background_save(player_ptr, TRUE);
+
     char safe[1024];
     strcpy(safe, savefile);
     strcat(safe, ".new");
@@ -277,24 +396,10 @@ bool save_player(player_type *player_ptr, save_type type)
     safe_setuid_drop();
     update_playtime();
     bool result = FALSE;
-    if (save_player_aux(player_ptr, safe, type)) {
-        char temp[1024];
-        char filename[1024];
-        strcpy(temp, savefile);
-        strcat(temp, ".old");
-        safe_setuid_grab(player_ptr);
-        fd_kill(temp);
-
-        if (type == SAVE_TYPE_DEBUG)
-            strcpy(filename, debug_savefile);
-        if (type != SAVE_TYPE_DEBUG)
-            strcpy(filename, savefile);
-
-        fd_move(filename, temp);
-        fd_move(safe, filename);
-        fd_kill(temp);
-        safe_setuid_drop();
-        current_world_ptr->character_loaded = TRUE;
+    if (type == SAVE_TYPE_BACKGROUND) {
+        result = save_player_background(player_ptr, safe);
+    } else if (save_player_aux(player_ptr, safe, type)) {
+        replace_savefile(player_ptr, safe, type);
         result = TRUE;
     }
 
@@ -306,4 +411,4 @@ bool save_player(player_type *player_ptr, save_type type)
     }
 
     return result;
-}
\ No newline at end of file
+}
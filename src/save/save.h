@@ -6,7 +6,9 @@
 typedef enum save_type {
 	SAVE_TYPE_CLOSE_GAME = 0,
 	SAVE_TYPE_CONTINUE_GAME = 1,
-	SAVE_TYPE_DEBUG = 2
+	SAVE_TYPE_DEBUG = 2,
+	SAVE_TYPE_BACKGROUND = 3
 }save_type;
 
 bool save_player(player_type *player_ptr, save_type type);
+void finish_background_save(player_type *player_ptr, bool wait);
@@ -260,8 +260,8 @@ bool earthquake(player_type *caster_ptr, POSITION cy, POSITION cx, POSITION r, M
                 continue;
 
             IDX m_idx_aux = floor_ptr->grid_array[yy][xx].m_idx;
-            floor_ptr->grid_array[yy][xx].m_idx = 0;
-            floor_ptr->grid_array[sy][sx].m_idx = m_idx_aux;
+            set_cave_monster(floor_ptr, yy, xx, 0);
+            set_cave_monster(floor_ptr, sy, sx, m_idx_aux);
             m_ptr->fy = sy;
             m_ptr->fx = sx;
             update_monster(caster_ptr, m_idx_aux, TRUE);
@@ -12,6 +12,7 @@
 #include "monster-race/monster-race-hook.h"
 #include "monster/monster-flag-types.h"
 #include "monster/monster-info.h"
+#include "monster/monster-list.h"
 #include "monster/monster-status.h"
 #include "monster/monster-update.h"
 #include "object-hook/hook-checker.h"
@@ -24,6 +25,7 @@
 #include "system/object-type-definition.h"
 #include "util/string-processor.h"
 #include "view/display-messages.h"
+#include "world/world.h"
 
 /*!
  * @brief プレイヤー周辺の地形を感知する
@@ -298,6 +300,25 @@ bool detect_objects_magic(player_type *caster_ptr, POSITION range)
     return detect;
 }
 
+/*!
+ * @brief 感知の効果範囲内にいるモンスターを列挙する / Collect monsters within the range of a detection
+ * @param caster_ptr プレーヤーへの参照ポインタ
+ * @param range 効果範囲
+ * @param m_idx_list 見つかったモンスターIDの配列を返す先
+ * @return 見つかったモンスターの数
+ * @details
+ * 配列は使い回す作業領域なので、次の呼び出しまでに使い終えること。
+ */
+static MONSTER_NUMBER collect_detect_targets(player_type *caster_ptr, POSITION range, MONSTER_IDX **m_idx_list)
+{
+    static MONSTER_IDX *detect_m_idx_list = NULL;
+    if (!detect_m_idx_list)
+        C_MAKE(detect_m_idx_list, current_world_ptr->max_m_idx, MONSTER_IDX);
+
+    *m_idx_list = detect_m_idx_list;
+    return collect_monsters_in_radius(caster_ptr->current_floor_ptr, caster_ptr->y, caster_ptr->x, range, detect_m_idx_list);
+}
+
 /*!
  * @brief 一般のモンスターを感知する / Detect all "normal" monsters on the current panel
  * @param caster_ptr プレーヤーへの参照ポインタ
@@ -310,16 +331,12 @@ bool detect_monsters_normal(player_type *caster_ptr, POSITION range)
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (!(r_ptr->flags2 & RF2_INVISIBLE) || caster_ptr->see_inv) {
             repair_monsters = TRUE;
@@ -350,19 +367,13 @@ bool detect_monsters_invis(player_type *caster_ptr, POSITION range)
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
 
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
-
         if (r_ptr->flags2 & RF2_INVISIBLE) {
             if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
                 caster_ptr->window |= (PW_MONSTER);
@@ -396,17 +407,12 @@ bool detect_monsters_evil(player_type *caster_ptr, POSITION range)
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (r_ptr->flags3 & RF3_EVIL) {
             if (is_original_ap(m_ptr)) {
@@ -442,15 +448,11 @@ bool detect_monsters_nonliving(player_type *caster_ptr, POSITION range)
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (!monster_living(m_ptr->r_idx)) {
             if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
@@ -483,17 +485,12 @@ bool detect_monsters_mind(player_type *caster_ptr, POSITION range)
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (!(r_ptr->flags2 & RF2_EMPTY_MIND)) {
             if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
@@ -527,17 +524,12 @@ bool detect_monsters_string(player_type *caster_ptr, POSITION range, concptr Mat
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (angband_strchr(Match, r_ptr->d_char)) {
             if (caster_ptr->monster_race_idx == m_ptr->r_idx) {
@@ -573,17 +565,12 @@ bool detect_monsters_xxx(player_type *caster_ptr, POSITION range, u32b match_fla
         range /= 3;
 
     bool flag = FALSE;
-    for (MONSTER_IDX i = 1; i < caster_ptr->current_floor_ptr->m_max; i++) {
+    MONSTER_IDX *m_idx_list;
+    MONSTER_NUMBER num = collect_detect_targets(caster_ptr, range, &m_idx_list);
+    for (MONSTER_NUMBER n = 0; n < num; n++) {
+        MONSTER_IDX i = m_idx_list[n];
         monster_type *m_ptr = &caster_ptr->current_floor_ptr->m_list[i];
         monster_race *r_ptr = &r_info[m_ptr->r_idx];
-        if (!monster_is_valid(m_ptr))
-            continue;
-
-        POSITION y = m_ptr->fy;
-        POSITION x = m_ptr->fx;
-
-        if (distance(caster_ptr->y, caster_ptr->x, y, x) > range)
-            continue;
 
         if (r_ptr->flags3 & (match_flag)) {
             if (is_original_ap(m_ptr)) {
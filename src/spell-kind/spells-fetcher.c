@@ -149,8 +149,8 @@ bool fetch_monster(player_type *caster_ptr)
         }
     }
 
-    caster_ptr->current_floor_ptr->grid_array[target_row][target_col].m_idx = 0;
-    caster_ptr->current_floor_ptr->grid_array[ty][tx].m_idx = m_idx;
+    set_cave_monster(caster_ptr->current_floor_ptr, target_row, target_col, 0);
+    set_cave_monster(caster_ptr->current_floor_ptr, ty, tx, m_idx);
     m_ptr->fy = ty;
     m_ptr->fx = tx;
     (void)set_monster_csleep(caster_ptr, m_idx, 0);
@@ -167,8 +167,8 @@ bool teleport_away(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION dis, tel
     }
 
     sound(SOUND_TPOTHER);
-    caster_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = 0;
-    caster_ptr->current_floor_ptr->grid_array[ny][nx].m_idx = m_idx;
+    set_cave_monster(caster_ptr->current_floor_ptr, oy, ox, 0);
+    set_cave_monster(caster_ptr->current_floor_ptr, ny, nx, m_idx);
 
     m_ptr->fy = ny;
     m_ptr->fx = nx;
@@ -242,8 +242,8 @@ void teleport_monster_to(player_type *caster_ptr, MONSTER_IDX m_idx, POSITION ty
         return;
 
     sound(SOUND_TPOTHER);
-    caster_ptr->current_floor_ptr->grid_array[oy][ox].m_idx = 0;
-    caster_ptr->current_floor_ptr->grid_array[ny][nx].m_idx = m_idx;
+    set_cave_monster(caster_ptr->current_floor_ptr, oy, ox, 0);
+    set_cave_monster(caster_ptr->current_floor_ptr, ny, nx, m_idx);
 
     m_ptr->fy = ny;
     m_ptr->fx = nx;
@@ -11,3 +11,27 @@ s16b alloc_kind_size;
 
 /* The entries in the "kind allocator table" */
 alloc_entry *alloc_kind_table;
+
+/*!
+ * @brief 生成テーブルの累積確率から抽選結果を探す / Find the entry a roll falls on
+ * @param table 生成テーブル (total に prob3 の累積値が入っていること)
+ * @param num 累積値が有効なエントリ数
+ * @param value 0 以上 table[num - 1].total 未満の抽選値
+ * @return total が value を超える最初のエントリの添字
+ * @details
+ * prob3 を先頭から引いていく線形走査と同じエントリを二分探索で返す。
+ */
+int find_alloc_entry(alloc_entry *table, int num, s32b value)
+{
+    int lo = 0;
+    int hi = num - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (table[mid].total > value)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    return lo;
+}
@@ -8,3 +8,5 @@ extern alloc_entry *alloc_race_table;
 
 extern s16b alloc_kind_size;
 extern alloc_entry *alloc_kind_table;
+
+int find_alloc_entry(alloc_entry *table, int num, s32b value);
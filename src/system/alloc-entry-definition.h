@@ -27,5 +27,5 @@ typedef struct alloc_entry {
     PROB prob2; /* Probability, pass 2 */
     PROB prob3; /* Probability, pass 3 */
 
-    u16b total; /* Unused for now */
+    s32b total; /* Sum of "prob3" up to this entry, pass 3 */
 } alloc_entry;
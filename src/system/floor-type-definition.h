@@ -4,12 +4,19 @@
 #include "floor/sight-definitions.h"
 #include "monster/monster-timed-effect-types.h"
 
+#define MONSTER_BUCKET_SIZE 8 /*!< モンスター空間索引の1区画の一辺のマス数 / Side length of a monster bucket in grids */
+
 typedef struct grid_type grid_type;
 typedef struct object_type object_type;
 typedef struct monster_type monster_type;
 typedef struct floor_type {
     DUNGEON_IDX dungeon_idx;
     grid_type *grid_array[MAX_HGT];
+    byte *cost_array[MAX_HGT]; /*!< MONSTER_FLOW 用の移動コスト / Cost of flowing */
+    byte *dist_array[MAX_HGT]; /*!< MONSTER_FLOW 用のプレイヤーからの距離 / Distance from player */
+    byte *when_array[MAX_HGT]; /*!< 匂いが付けられた時刻 / When the scent was laid */
+    BIT_FLAGS8 *pass_array[MAX_HGT]; /*!< 地形の通過特性 (PASS_*) / Traversal class of the terrain */
+    u32b pass_version; /*!< pass_array を書き換えるたびに増える値 / Bumped whenever pass_array changes */
     DEPTH dun_level; /*!< 現在の実ダンジョン階層 base_level の参照元となる / Current dungeon level */
     DEPTH base_level; /*!< 基本生成レベル、後述のobject_level, monster_levelの参照元となる / Base dungeon level */
     DEPTH object_level; /*!< アイテムの生成レベル、 base_level を起点に一時変更する時に参照 / Current object creation level */
@@ -27,6 +34,8 @@ typedef struct floor_type {
     monster_type *m_list; /*!< The array of dungeon monsters [max_m_idx] */
     MONSTER_IDX m_max; /* Number of allocated monsters */
     MONSTER_IDX m_cnt; /* Number of live monsters */
+    byte m_bucket_num[MAX_HGT / MONSTER_BUCKET_SIZE + 1][MAX_WID / MONSTER_BUCKET_SIZE + 1]; /*!< 区画ごとのモンスター数 / Number of monsters in each bucket */
+    BIT_FLAGS *m_active; /*!< AAF_LIMIT 内にいる可能性があるモンスターのビット集合 / Bitset of monsters which may be within AAF_LIMIT [max_m_idx] */
 
     s16b *mproc_list[MAX_MTIMED]; /*!< The array to process dungeon monsters[max_m_idx] */
     s16b mproc_max[MAX_MTIMED]; /*!< Number of monsters to be processed */
@@ -460,7 +460,7 @@ static concptr decide_target_floor(player_type *subject_ptr, eg_type *eg_ptr)
     return f_name + eg_ptr->f_ptr->name;
 }
 
-static void describe_grid_monster_all(eg_type *eg_ptr)
+static void describe_grid_monster_all(player_type *subject_ptr, eg_type *eg_ptr)
 {
     if (!current_world_ptr->wizard) {
 #ifdef JP
@@ -471,6 +471,7 @@ static void describe_grid_monster_all(eg_type *eg_ptr)
         return;
     }
 
+    floor_type *floor_ptr = subject_ptr->current_floor_ptr;
     char f_idx_str[32];
     if (eg_ptr->g_ptr->mimic)
         sprintf(f_idx_str, "%d/%d", eg_ptr->g_ptr->feat, eg_ptr->g_ptr->mimic);
@@ -479,11 +480,13 @@ static void describe_grid_monster_all(eg_type *eg_ptr)
 
 #ifdef JP
     sprintf(eg_ptr->out_val, "%s%s%s%s[%s] %x %s %d %d %d (%d,%d) %d", eg_ptr->s1, eg_ptr->name, eg_ptr->s2, eg_ptr->s3, eg_ptr->info,
-        (unsigned int)eg_ptr->g_ptr->info, f_idx_str, eg_ptr->g_ptr->dist, eg_ptr->g_ptr->cost, eg_ptr->g_ptr->when, (int)eg_ptr->y, (int)eg_ptr->x,
+        (unsigned int)eg_ptr->g_ptr->info, f_idx_str, floor_ptr->dist_array[eg_ptr->y][eg_ptr->x], floor_ptr->cost_array[eg_ptr->y][eg_ptr->x],
+        floor_ptr->when_array[eg_ptr->y][eg_ptr->x], (int)eg_ptr->y, (int)eg_ptr->x,
         travel.cost[eg_ptr->y][eg_ptr->x]);
 #else
     sprintf(eg_ptr->out_val, "%s%s%s%s [%s] %x %s %d %d %d (%d,%d)", eg_ptr->s1, eg_ptr->s2, eg_ptr->s3, eg_ptr->name, eg_ptr->info, eg_ptr->g_ptr->info,
-        f_idx_str, eg_ptr->g_ptr->dist, eg_ptr->g_ptr->cost, eg_ptr->g_ptr->when, (int)eg_ptr->y, (int)eg_ptr->x);
+        f_idx_str, floor_ptr->dist_array[eg_ptr->y][eg_ptr->x], floor_ptr->cost_array[eg_ptr->y][eg_ptr->x],
+        floor_ptr->when_array[eg_ptr->y][eg_ptr->x], (int)eg_ptr->y, (int)eg_ptr->x);
 #endif
 }
 
@@ -556,7 +559,7 @@ char examine_grid(player_type *subject_ptr, const POSITION y, const POSITION x,
         eg_ptr->s3 = (is_a_vowel(eg_ptr->name[0])) ? "an " : "a ";
 #endif
 
-    describe_grid_monster_all(eg_ptr);
+    describe_grid_monster_all(subject_ptr, eg_ptr);
     prt(eg_ptr->out_val, 0, 0);
     move_cursor_relative(y, x);
     eg_ptr->query = inkey();
@@ -17,6 +17,10 @@
 #include "term/term-color-types.h"
 #include "term/z-virt.h"
 
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
 /* Special flags in the attr data */
 #define AF_BIGTILE2 0xf0
 #define AF_TILE1 0x80
@@ -32,9 +36,36 @@
 #define AF_KANJIC 0x0f
 #endif
 
+/*
+ * Maximum number of unchanged grids of the same color bridged in term_fresh_row_text()
+ * to draw two nearby runs with one call of the text hook
+ */
+#define TERM_FRESH_GAP 4
+
 /* The current "term" */
 term_type *Term = NULL;
 
+/* Maximum number of frames per second presented by term_fresh_frame() (0 means no limit) */
+int term_fresh_fps = TERM_FRESH_FPS;
+
+#ifdef HAVE_SYS_TIME_H
+/*
+ * @brief 現在の時刻をミリ秒単位で返す / Return the current time in milliseconds
+ */
+static u32b term_clock_default(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (u32b)tv.tv_sec * 1000u + (u32b)(tv.tv_usec / 1000);
+}
+
+/* Hook to get the current time in milliseconds (NULL disables the frame limit) */
+u32b (*term_clock_aux)(void) = term_clock_default;
+#else
+/* Hook to get the current time in milliseconds (NULL disables the frame limit) */
+u32b (*term_clock_aux)(void) = NULL;
+#endif
+
 /*** Local routines ***/
 
 /*
@@ -889,6 +920,9 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
     /* Pending attr */
     byte fa = Term->attr_blank;
 
+    /* Unchanged grids after the pending chars */
+    int gap = 0;
+
     TERM_COLOR oa;
     char oc;
 
@@ -940,6 +974,21 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 #endif
 
         {
+            /* Bridge a short gap of the same color */
+#ifdef JP
+            if (fn && (fa == (na & AF_KANJIC)) && (gap + 1 + kanji <= TERM_FRESH_GAP)) {
+                gap += 1 + kanji;
+                x += kanji;
+                kanji = 0;
+                continue;
+            }
+#else
+            if (fn && (fa == na) && (gap < TERM_FRESH_GAP)) {
+                gap++;
+                continue;
+            }
+#endif
+
             /* Flush */
             if (fn) {
                 /* Draw pending chars (normal) */
@@ -954,6 +1003,7 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 
                 /* Forget */
                 fn = 0;
+                gap = 0;
             }
 
 #ifdef JP
@@ -994,6 +1044,7 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 
                 /* Forget */
                 fn = 0;
+                gap = 0;
             }
 
             /* Save the new color */
@@ -1004,6 +1055,10 @@ static void term_fresh_row_text(TERM_LEN y, TERM_LEN x1, TERM_LEN x2)
 #endif
         }
 
+        /* Redraw the bridged gap with the pending chars */
+        fn += gap;
+        gap = 0;
+
         /* Restart and Advance */
         if (fn++ == 0)
             fx = x;
@@ -1031,6 +1086,22 @@ bool macro_running(void)
 
 bool need_term_fresh(player_type *player_ptr) { return (!macro_running() && !continuous_action_running(player_ptr)) || fresh_after; }
 
+/*
+ * @brief 表示フレームレートの上限を超えない範囲で画面を更新する / Perform the requested changes unless a frame was presented too recently
+ * @return 更新を見送った場合は1
+ * @details
+ * 連続行動中やアニメーションの途中経過のように、すぐに次の描画が続く場面で使う。
+ * 見送った変更は書き換え範囲に残るので、次にterm_fresh()が呼ばれた時にまとめて描画される。
+ * Intermediate frames are coalesced into the next one instead of being flushed to the backend.
+ */
+errr term_fresh_frame(void)
+{
+    if ((term_fresh_fps > 0) && term_clock_aux && ((*term_clock_aux)() - Term->fresh_time < (u32b)(1000 / term_fresh_fps)))
+        return 1;
+
+    return term_fresh();
+}
+
 /*
  * @brief Actually perform all requested changes to the window
  */
@@ -1059,6 +1130,10 @@ errr term_fresh(void)
         return 1;
     }
 
+    /* Remember when the frame was presented */
+    if (term_clock_aux)
+        Term->fresh_time = (*term_clock_aux)();
+
     /* Handle "total erase" */
     if (Term->total_erase) {
         byte na = Term->attr_blank;
@@ -76,6 +76,8 @@ typedef struct term_type {
     TERM_LEN *x1; //!< Minimum modified column(per row)
     TERM_LEN *x2; //!< Maximum modified column(per row)
 
+    u32b fresh_time; //!< 最後に画面を更新した時刻(ミリ秒) / Time of the last presented frame in milliseconds
+
     term_win *old; //!< Displayed screen image
     term_win *scr; //!< Requested screen image
 
@@ -136,8 +138,12 @@ typedef struct player_type player_type;
 #define TERM_XTRA_MUSIC_TOWN 17 /* Play a music(floor)   (optional) */
 #define TERM_XTRA_MUSIC_MUTE 18
 
+#define TERM_FRESH_FPS 60 /* Default limit of frames per second presented by term_fresh_frame() */
+
 /**** Available Variables ****/
 extern term_type *Term;
+extern int term_fresh_fps;
+extern u32b (*term_clock_aux)(void);
 
 errr term_win_nuke(term_win *s, TERM_LEN w, TERM_LEN h);
 errr term_user(int n);
@@ -152,6 +158,7 @@ bool need_term_fresh(player_type *player_ptr);
 bool macro_running(void);
 
 errr term_fresh(void);
+errr term_fresh_frame(void);
 errr term_set_cursor(int v);
 errr term_gotoxy(TERM_LEN x, TERM_LEN y);
 errr term_draw(TERM_LEN x, TERM_LEN y, TERM_COLOR a, char c);
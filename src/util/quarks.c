@@ -6,36 +6,104 @@
 STR_OFFSET quark__num;
 
 /*
- * The pointers to the quarks [QUARK_MAX]
+ * The pointers to the quarks [quark__size]
  */
 concptr *quark__str;
 
+/*
+ * The size of quark__str[], grows as needed
+ */
+static STR_OFFSET quark__size;
+
+/*
+ * Open addressing hash table of the quark indexes [quark__hash_size], 0 for an empty slot
+ */
+static u16b *quark__hash;
+static STR_OFFSET quark__hash_size;
+
+/*
+ * Hash a string (FNV-1a)
+ */
+static u32b quark_hash(concptr str)
+{
+    u32b hash = 2166136261UL;
+    for (concptr s = str; *s; s++)
+        hash = (hash ^ (byte)*s) * 16777619UL;
+
+    return hash;
+}
+
+/*
+ * Find the slot of the hash table for a string
+ * Returns the slot holding the string, or the empty slot where it should go
+ */
+static STR_OFFSET quark_find_slot(concptr str)
+{
+    STR_OFFSET mask = quark__hash_size - 1;
+    STR_OFFSET slot = quark_hash(str) & mask;
+    while (quark__hash[slot] && !streq(quark__str[quark__hash[slot]], str))
+        slot = (slot + 1) & mask;
+
+    return slot;
+}
+
+/*
+ * Make the hash table for the current quarks
+ * The table is kept at most half full
+ */
+static void quark_rehash(void)
+{
+    if (quark__hash)
+        C_KILL(quark__hash, quark__hash_size, u16b);
+
+    quark__hash_size = 1;
+    while (quark__hash_size < quark__size * 2)
+        quark__hash_size *= 2;
+
+    C_MAKE(quark__hash, quark__hash_size, u16b);
+    for (STR_OFFSET i = 1; i < quark__num; i++)
+        quark__hash[quark_find_slot(quark__str[i])] = (u16b)i;
+}
+
 /*
  * Initialize the quark array
  */
 void quark_init(void)
 {
-    C_MAKE(quark__str, QUARK_MAX, concptr);
+    quark__size = QUARK_MAX;
+    C_MAKE(quark__str, quark__size, concptr);
     quark__str[1] = string_make("");
     quark__num = 2;
+    quark_rehash();
 }
 
 /*
  * Add a new "quark" to the set of quarks.
+ * The array grows as needed, up to the range of the index
  */
 u16b quark_add(concptr str)
 {
-    u16b i;
-    for (i = 1; i < quark__num; i++) {
-        if (streq(quark__str[i], str))
-            return (i);
-    }
+    STR_OFFSET slot = quark_find_slot(str);
+    if (quark__hash[slot])
+        return quark__hash[slot];
 
-    if (quark__num == QUARK_MAX)
+    if (quark__num > MAX_QUARK_INDEX)
         return 1;
 
-    quark__num = i + 1;
+    if (quark__num == quark__size) {
+        concptr *old_str = quark__str;
+        STR_OFFSET old_size = quark__size;
+        quark__size = old_size * 2;
+        C_MAKE(quark__str, quark__size, concptr);
+        C_COPY(quark__str, old_str, old_size, concptr);
+        C_KILL(old_str, old_size, concptr);
+        quark_rehash();
+        slot = quark_find_slot(str);
+    }
+
+    u16b i = (u16b)quark__num++;
     quark__str[i] = string_make(str);
+    quark__hash[slot] = i;
     return (i);
 }
 
@@ -3,13 +3,20 @@
 #include "system/angband.h"
 
 /*!
- * @brief 銘情報の最大数 / Maximum number of "quarks" (see "io.c")
+ * @brief 銘情報の初期の数 / Initial number of "quarks" (see "io.c")
  * @note
  * Default: assume at most 512 different inscriptions are used<br>
  * Was 512... 256 quarks added for random artifacts<br>
+ * The array grows when more are used.
  */
 #define QUARK_MAX 768
 
+/*!
+ * @brief 銘情報の番号の最大値 / Maximum index of "quarks"
+ * @note The index is stored in u16b fields of object_type
+ */
+#define MAX_QUARK_INDEX 65535
+
 extern STR_OFFSET quark__num;
 extern concptr *quark__str;
 
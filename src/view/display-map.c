@@ -80,104 +80,171 @@ static void image_random(TERM_COLOR *ap, SYMBOL_CODE *cp)
 }
 
 /*!
- * @brief Mコマンドによる縮小マップの表示を行う / Extract the attr/char to display at the given (legal) map location
+ * @brief 地形表示のキャッシュ / Cached feature and lighting shown on a grid
+ * @details
+ * 地形の表示はマス自身の情報と表示オプション等の大域的な状態だけで決まるので、
+ * それらが前回と同じならば計算を省略する。
+ * 隣接マスの照明に依存する場合はキャッシュしない。
  */
-void map_info(player_type *player_ptr, POSITION y, POSITION x, TERM_COLOR *ap, SYMBOL_CODE *cp, TERM_COLOR *tap, SYMBOL_CODE *tcp)
+typedef struct map_info_cache_type {
+    u32b key; //!< 計算時の大域的な状態 (0は無効)
+    BIT_FLAGS info; //!< 計算時のマスの情報フラグ
+    FEAT_IDX feat; //!< 計算時の地形ID
+    FEAT_IDX mimic; //!< 計算時の擬態地形ID
+    FEAT_IDX shown_feat; //!< 表示する地形ID
+    byte lighting; //!< 表示する照明状態 (F_LIT_*)
+} map_info_cache_type;
+
+static map_info_cache_type map_info_cache[MAX_HGT][MAX_WID];
+
+/*!
+ * @brief 地形の表示に影響する大域的な状態をまとめる / Gather the global state affecting the display of features
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @return 状態を表す値 (0にはならない)
+ */
+u32b get_map_info_cache_key(player_type *player_ptr)
 {
-    floor_type *floor_ptr = player_ptr->current_floor_ptr;
-    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
-    OBJECT_IDX this_o_idx, next_o_idx = 0;
+    u32b key = 1UL << 31;
+    if (player_ptr->blind)
+        key |= 1UL << 0;
+    if (player_ptr->see_nocto)
+        key |= 1UL << 1;
+    if (player_ptr->wild_mode)
+        key |= 1UL << 2;
+    if (player_ptr->wild_mode && is_daytime())
+        key |= 1UL << 3;
+    if (view_special_lite)
+        key |= 1UL << 4;
+    if (view_yellow_lite)
+        key |= 1UL << 5;
+    if (view_bright_lite)
+        key |= 1UL << 6;
+    if (view_granite_lite)
+        key |= 1UL << 7;
+    if (view_unsafe_grids)
+        key |= 1UL << 8;
+
+    return key;
+}
+
+/*!
+ * @brief 指定したマスに表示する地形と照明状態を求める / Extract the feature and the lighting to display at the given map location
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param y 対象マスのY座標
+ * @param x 対象マスのX座標
+ * @param lighting 照明状態 (F_LIT_*) を返す参照ポインタ
+ * @param cacheable 周囲のマスに依存せず結果をキャッシュできるならばTRUEを返す参照ポインタ
+ * @return 表示する地形ID
+ */
+static FEAT_IDX get_map_info_feature(player_type *player_ptr, POSITION y, POSITION x, byte *lighting, bool *cacheable)
+{
+    grid_type *g_ptr = &player_ptr->current_floor_ptr->grid_array[y][x];
     FEAT_IDX feat = get_feat_mimic(g_ptr);
     feature_type *f_ptr = &f_info[feat];
-    TERM_COLOR a;
-    SYMBOL_CODE c;
+    FEAT_IDX unknown_feat = (view_unsafe_grids && (g_ptr->info & CAVE_UNSAFE)) ? feat_undetected : feat_none;
+    *lighting = F_LIT_STANDARD;
+    *cacheable = TRUE;
     if (!has_flag(f_ptr->flags, FF_REMEMBER)) {
-        if (!player_ptr->blind
-            && ((g_ptr->info & (CAVE_MARK | CAVE_LITE | CAVE_MNLT))
-                || ((g_ptr->info & CAVE_VIEW) && (((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) == CAVE_GLOW) || player_ptr->see_nocto)))) {
-            a = f_ptr->x_attr[F_LIT_STANDARD];
-            c = f_ptr->x_char[F_LIT_STANDARD];
-            if (player_ptr->wild_mode) {
-                if (view_special_lite && !is_daytime()) {
-                    a = f_ptr->x_attr[F_LIT_DARK];
-                    c = f_ptr->x_char[F_LIT_DARK];
-                }
-            } else if (darkened_grid(player_ptr, g_ptr)) {
-                feat = (view_unsafe_grids && (g_ptr->info & CAVE_UNSAFE)) ? feat_undetected : feat_none;
-                f_ptr = &f_info[feat];
-                a = f_ptr->x_attr[F_LIT_STANDARD];
-                c = f_ptr->x_char[F_LIT_STANDARD];
-            } else if (view_special_lite) {
-                if (g_ptr->info & (CAVE_LITE | CAVE_MNLT)) {
-                    if (view_yellow_lite) {
-                        a = f_ptr->x_attr[F_LIT_LITE];
-                        c = f_ptr->x_char[F_LIT_LITE];
-                    }
-                } else if ((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
-                    a = f_ptr->x_attr[F_LIT_DARK];
-                    c = f_ptr->x_char[F_LIT_DARK];
-                } else if (!(g_ptr->info & CAVE_VIEW)) {
-                    if (view_bright_lite) {
-                        a = f_ptr->x_attr[F_LIT_DARK];
-                        c = f_ptr->x_char[F_LIT_DARK];
-                    }
-                }
+        if (player_ptr->blind
+            || (!(g_ptr->info & (CAVE_MARK | CAVE_LITE | CAVE_MNLT))
+                && (!(g_ptr->info & CAVE_VIEW) || (((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) && !player_ptr->see_nocto))))
+            return unknown_feat;
+
+        if (player_ptr->wild_mode) {
+            if (view_special_lite && !is_daytime())
+                *lighting = F_LIT_DARK;
+        } else if (darkened_grid(player_ptr, g_ptr)) {
+            return unknown_feat;
+        } else if (view_special_lite) {
+            if (g_ptr->info & (CAVE_LITE | CAVE_MNLT)) {
+                if (view_yellow_lite)
+                    *lighting = F_LIT_LITE;
+            } else if ((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
+                *lighting = F_LIT_DARK;
+            } else if (!(g_ptr->info & CAVE_VIEW)) {
+                if (view_bright_lite)
+                    *lighting = F_LIT_DARK;
             }
-        } else {
-            feat = (view_unsafe_grids && (g_ptr->info & CAVE_UNSAFE)) ? feat_undetected : feat_none;
-            f_ptr = &f_info[feat];
-            a = f_ptr->x_attr[F_LIT_STANDARD];
-            c = f_ptr->x_char[F_LIT_STANDARD];
         }
-    } else {
-        if (g_ptr->info & CAVE_MARK) {
-            a = f_ptr->x_attr[F_LIT_STANDARD];
-            c = f_ptr->x_char[F_LIT_STANDARD];
-            if (player_ptr->wild_mode) {
-                if (view_granite_lite && (player_ptr->blind || !is_daytime())) {
-                    a = f_ptr->x_attr[F_LIT_DARK];
-                    c = f_ptr->x_char[F_LIT_DARK];
-                }
-            } else if (darkened_grid(player_ptr, g_ptr) && !player_ptr->blind) {
-                if (has_flag(f_ptr->flags, FF_LOS) && has_flag(f_ptr->flags, FF_PROJECT)) {
-                    feat = (view_unsafe_grids && (g_ptr->info & CAVE_UNSAFE)) ? feat_undetected : feat_none;
-                    f_ptr = &f_info[feat];
-                    a = f_ptr->x_attr[F_LIT_STANDARD];
-                    c = f_ptr->x_char[F_LIT_STANDARD];
-                } else if (view_granite_lite && view_bright_lite) {
-                    a = f_ptr->x_attr[F_LIT_DARK];
-                    c = f_ptr->x_char[F_LIT_DARK];
-                }
-            } else if (view_granite_lite) {
-                if (player_ptr->blind) {
-                    a = f_ptr->x_attr[F_LIT_DARK];
-                    c = f_ptr->x_char[F_LIT_DARK];
-                } else if (g_ptr->info & (CAVE_LITE | CAVE_MNLT)) {
-                    if (view_yellow_lite) {
-                        a = f_ptr->x_attr[F_LIT_LITE];
-                        c = f_ptr->x_char[F_LIT_LITE];
-                    }
-                } else if (view_bright_lite) {
-                    if (!(g_ptr->info & CAVE_VIEW)) {
-                        a = f_ptr->x_attr[F_LIT_DARK];
-                        c = f_ptr->x_char[F_LIT_DARK];
-                    } else if ((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
-                        a = f_ptr->x_attr[F_LIT_DARK];
-                        c = f_ptr->x_char[F_LIT_DARK];
-                    } else if (!has_flag(f_ptr->flags, FF_LOS) && !check_local_illumination(player_ptr, y, x)) {
-                        a = f_ptr->x_attr[F_LIT_DARK];
-                        c = f_ptr->x_char[F_LIT_DARK];
-                    }
-                }
+
+        return feat;
+    }
+
+    if (!(g_ptr->info & CAVE_MARK))
+        return unknown_feat;
+
+    if (player_ptr->wild_mode) {
+        if (view_granite_lite && (player_ptr->blind || !is_daytime()))
+            *lighting = F_LIT_DARK;
+    } else if (darkened_grid(player_ptr, g_ptr) && !player_ptr->blind) {
+        if (has_flag(f_ptr->flags, FF_LOS) && has_flag(f_ptr->flags, FF_PROJECT))
+            return unknown_feat;
+
+        if (view_granite_lite && view_bright_lite)
+            *lighting = F_LIT_DARK;
+    } else if (view_granite_lite) {
+        if (player_ptr->blind) {
+            *lighting = F_LIT_DARK;
+        } else if (g_ptr->info & (CAVE_LITE | CAVE_MNLT)) {
+            if (view_yellow_lite)
+                *lighting = F_LIT_LITE;
+        } else if (view_bright_lite) {
+            if (!(g_ptr->info & CAVE_VIEW)) {
+                *lighting = F_LIT_DARK;
+            } else if ((g_ptr->info & (CAVE_GLOW | CAVE_MNDK)) != CAVE_GLOW) {
+                *lighting = F_LIT_DARK;
+            } else if (!has_flag(f_ptr->flags, FF_LOS)) {
+                *cacheable = FALSE;
+                if (!check_local_illumination(player_ptr, y, x))
+                    *lighting = F_LIT_DARK;
             }
-        } else {
-            feat = (view_unsafe_grids && (g_ptr->info & CAVE_UNSAFE)) ? feat_undetected : feat_none;
-            f_ptr = &f_info[feat];
-            a = f_ptr->x_attr[F_LIT_STANDARD];
-            c = f_ptr->x_char[F_LIT_STANDARD];
         }
     }
 
+    return feat;
+}
+
+/*!
+ * @brief キャッシュを使って指定したマスに表示する地形と照明状態を求める / Extract the feature and the lighting to display, using the cache if possible
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param y 対象マスのY座標
+ * @param x 対象マスのX座標
+ * @param lighting 照明状態 (F_LIT_*) を返す参照ポインタ
+ * @return 表示する地形ID
+ */
+static FEAT_IDX get_map_info_feature_cached(player_type *player_ptr, POSITION y, POSITION x, byte *lighting)
+{
+    grid_type *g_ptr = &player_ptr->current_floor_ptr->grid_array[y][x];
+    map_info_cache_type *cache_ptr = &map_info_cache[y][x];
+    u32b key = get_map_info_cache_key(player_ptr);
+    if ((cache_ptr->key == key) && (cache_ptr->info == g_ptr->info) && (cache_ptr->feat == g_ptr->feat) && (cache_ptr->mimic == g_ptr->mimic)) {
+        *lighting = cache_ptr->lighting;
+        return cache_ptr->shown_feat;
+    }
+
+    bool cacheable;
+    FEAT_IDX feat = get_map_info_feature(player_ptr, y, x, lighting, &cacheable);
+    cache_ptr->key = cacheable ? key : 0;
+    cache_ptr->info = g_ptr->info;
+    cache_ptr->feat = g_ptr->feat;
+    cache_ptr->mimic = g_ptr->mimic;
+    cache_ptr->shown_feat = feat;
+    cache_ptr->lighting = *lighting;
+    return feat;
+}
+
+/*!
+ * @brief Mコマンドによる縮小マップの表示を行う / Extract the attr/char to display at the given (legal) map location
+ */
+void map_info(player_type *player_ptr, POSITION y, POSITION x, TERM_COLOR *ap, SYMBOL_CODE *cp, TERM_COLOR *tap, SYMBOL_CODE *tcp)
+{
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    grid_type *g_ptr = &floor_ptr->grid_array[y][x];
+    OBJECT_IDX this_o_idx, next_o_idx = 0;
+    byte lighting;
+    feature_type *f_ptr = &f_info[get_map_info_feature_cached(player_ptr, y, x, &lighting)];
+    TERM_COLOR a = f_ptr->x_attr[lighting];
+    SYMBOL_CODE c = f_ptr->x_char[lighting];
     if (feat_priority == -1)
         feat_priority = f_ptr->priority;
 
@@ -9,4 +9,5 @@ extern byte display_autopick;
 extern char image_object_hack[MAX_IMAGE_OBJECT_HACK];
 extern char image_monster_hack[MAX_IMAGE_MONSTER_HACK];
 
+u32b get_map_info_cache_key(player_type *player_ptr);
 void map_info(player_type *player_ptr, POSITION y, POSITION x, TERM_COLOR *ap, SYMBOL_CODE *cp, TERM_COLOR *tap, SYMBOL_CODE *tcp);
@@ -24,8 +24,11 @@ u32b message__head;
 /* The offset to the oldest used char (none yet) */
 u32b message__tail;
 
-/* The array of offsets, by index [MESSAGE_MAX] */
-u32b *message__ptr;
+/* The array of message records, by index [MESSAGE_MAX] */
+message_type *message__log;
+
+/* The newest recent message in each hash bucket, as index + 1 [MESSAGE_HASH_SIZE] */
+u32b *message__hash;
 
 /* The array of chars, by offset [MESSAGE_BUF] */
 char *message__buf;
@@ -63,20 +66,168 @@ concptr message_str(int age)
         return ("");
 
     s32b x = (message__next + MESSAGE_MAX - (age + 1)) % MESSAGE_MAX;
-    s32b o = message__ptr[x];
+    s32b o = message__log[x].offset;
     concptr s = &message__buf[o];
     return (s);
 }
 
+/*!
+ * @brief メッセージ文字列のハッシュ値を返す / Hash the text of a message (FNV-1a)
+ * @params str メッセージ
+ * @return ハッシュ値
+ */
+static u32b message_hash(concptr str)
+{
+    u32b hash = 2166136261UL;
+    for (concptr s = str; *s; s++)
+        hash = (hash ^ (byte)*s) * 16777619UL;
+
+    return hash;
+}
+
+/*!
+ * @brief メッセージの繰り返し回数の表記を解析して記録する / Record the " <xN>" suffix of a message
+ * @params msg_ptr メッセージの記録
+ * @params str メッセージ
+ * @return なし
+ * @details
+ * 末尾の表記の無いメッセージは1回とする。
+ * 表記があっても全体が短いものは繰り返しをまとめない。
+ */
+static void message_parse(message_type *msg_ptr, concptr str)
+{
+    concptr t;
+#ifdef JP
+    for (t = str; *t && (*t != '<' || (*(t + 1) != 'x')); t++)
+        if (iskanji(*t) && *(t + 1))
+            t++;
+#else
+    for (t = str; *t && (*t != '<'); t++)
+        ;
+#endif
+    msg_ptr->collapsible = TRUE;
+    msg_ptr->base_len = (u16b)strlen(str);
+    msg_ptr->count = 1;
+    if (!*t)
+        return;
+
+    if (strlen(str) < A_MAX) {
+        msg_ptr->collapsible = FALSE;
+        return;
+    }
+
+    if (t > str)
+        msg_ptr->base_len = (u16b)(t - str - 1);
+
+    msg_ptr->count = *(t + 1) ? atoi(t + 2) : 0;
+}
+
+/*!
+ * @brief メッセージをハッシュ表から外す / Remove a message from its hash bucket
+ * @params x メッセージの番号
+ * @return なし
+ */
+static void message_unlink(u32b x)
+{
+    message_type *msg_ptr = &message__log[x];
+    if (!msg_ptr->hashed)
+        return;
+
+    if (msg_ptr->hash_prev)
+        message__log[msg_ptr->hash_prev - 1].hash_next = msg_ptr->hash_next;
+    else
+        message__hash[msg_ptr->hash & (MESSAGE_HASH_SIZE - 1)] = msg_ptr->hash_next;
+
+    if (msg_ptr->hash_next)
+        message__log[msg_ptr->hash_next - 1].hash_prev = msg_ptr->hash_prev;
+
+    msg_ptr->hashed = FALSE;
+}
+
+/*!
+ * @brief メッセージをハッシュ表の先頭に加える / Add the newest message to its hash bucket
+ * @params x メッセージの番号
+ * @return なし
+ * @details
+ * 重複を探す範囲より古くなったメッセージは外すため、各バケットは新しい順に並ぶ。
+ */
+static void message_link(u32b x)
+{
+    message_unlink((x + MESSAGE_MAX - MESSAGE_HASH_AGE - 1) % MESSAGE_MAX);
+    message_unlink(x);
+
+    message_type *msg_ptr = &message__log[x];
+    u32b *head = &message__hash[msg_ptr->hash & (MESSAGE_HASH_SIZE - 1)];
+    msg_ptr->hash_prev = 0;
+    msg_ptr->hash_next = *head;
+    if (*head)
+        message__log[*head - 1].hash_prev = x + 1;
+
+    *head = x + 1;
+    msg_ptr->hashed = TRUE;
+}
+
+/*!
+ * @brief 新しいメッセージの番号を確保する / Allocate the index of a new message
+ * @return メッセージの番号
+ */
+static u32b message_next_index(void)
+{
+    u32b x = message__next++;
+    if (message__next == MESSAGE_MAX)
+        message__next = 0;
+    if (message__next == message__last)
+        message__last++;
+    if (message__last == MESSAGE_MAX)
+        message__last = 0;
+
+    return x;
+}
+
+/*!
+ * @brief 最近の同じ文字列のメッセージを探す / Find a recent message with the same text
+ * @params str メッセージ
+ * @params hash メッセージのハッシュ値
+ * @params k 探すメッセージの数
+ * @return 見つかったメッセージの番号、なければ-1
+ * @details
+ * 最新のものから k 個 (最古のメッセージは除く) のうち、
+ * 文字列が格納領域の後半に残っているものを探す。
+ */
+static s32b message_find_recent(concptr str, u32b hash, int k)
+{
+    u32b num = (u32b)message_num();
+    for (u32b x = message__hash[hash & (MESSAGE_HASH_SIZE - 1)]; x; x = message__log[x - 1].hash_next) {
+        message_type *msg_ptr = &message__log[x - 1];
+        u32b age = (message__next + MESSAGE_MAX - (x - 1)) % MESSAGE_MAX;
+        if ((age > (u32b)k) || (age >= num))
+            break;
+
+        if (msg_ptr->hash != hash)
+            continue;
+
+        u32b q = (message__head + MESSAGE_BUF - msg_ptr->offset) % MESSAGE_BUF;
+        if (q > MESSAGE_BUF / 2)
+            continue;
+
+        if (streq(&message__buf[msg_ptr->offset], str))
+            return (s32b)(x - 1);
+    }
+
+    return -1;
+}
+
 /*!
  * @brief ゲームメッセージをログに追加する。 / Add a new message, with great efficiency
  * @params str 保存したいメッセージ
  * @return なし
+ * @details
+ * 直前と同じメッセージは " <xN>" を付けた1件にまとめ、
+ * 最近と同じ文字列は格納領域を共有する。どちらもメッセージの記録とハッシュ表から定数時間で判定する。
  */
 void message_add(concptr str)
 {
     u32b i;
-    int x, m;
     char u[4096];
     char splitted1[81];
     concptr splitted2;
@@ -116,44 +267,22 @@ void message_add(concptr str)
         splitted2 = NULL;
     }
 
-    m = message_num();
+    int m = message_num();
     int k = m / 4;
-    if (k > MESSAGE_MAX / 32)
-        k = MESSAGE_MAX / 32;
-    for (i = message__next; m; m--) {
-        int j = 1;
-        char buf[1024];
-        char *t;
-        concptr old;
-        if (i-- == 0)
-            i = MESSAGE_MAX - 1;
-
-        old = &message__buf[message__ptr[i]];
-        if (!old)
-            continue;
-
-        strcpy(buf, old);
-#ifdef JP
-        for (t = buf; *t && (*t != '<' || (*(t + 1) != 'x')); t++)
-            if (iskanji(*t))
-                t++;
-#else
-        for (t = buf; *t && (*t != '<'); t++)
-            ;
-#endif
-        if (*t) {
-            if (strlen(buf) < A_MAX)
-                break;
-
-            *(t - 1) = '\0';
-            j = atoi(t + 2);
-        }
-
-        if (streq(buf, str) && (j < 1000)) {
-            j++;
+    if (k > MESSAGE_HASH_AGE)
+        k = MESSAGE_HASH_AGE;
+    if (m) {
+        i = (message__next + MESSAGE_MAX - 1) % MESSAGE_MAX;
+        message_type *old_ptr = &message__log[i];
+        concptr old = &message__buf[old_ptr->offset];
+        if (!old_ptr->collapsible) {
+            /* Never collapse into a short message with '<' */
+        } else if ((old_ptr->base_len == n) && !strncmp(old, str, n) && (old_ptr->count < 1000)) {
+            message_unlink(i);
             message__next = i;
+            strncpy(u, old, n);
+            sprintf(u + n, " <x%d>", old_ptr->count + 1);
             str = u;
-            sprintf(u, "%s <x%d>", buf, j);
             n = strlen(str);
             if (!now_message)
                 now_message++;
@@ -162,38 +291,20 @@ void message_add(concptr str)
             num_more++;
             now_message++;
         }
-
-        break;
     }
 
-    for (i = message__next; k; k--) {
-        int q;
-        concptr old;
-
-        if (i-- == 0)
-            i = MESSAGE_MAX - 1;
-
-        if (i == message__last)
-            break;
-
-        q = (message__head + MESSAGE_BUF - message__ptr[i]) % MESSAGE_BUF;
-
-        if (q > MESSAGE_BUF / 2)
-            continue;
-
-        old = &message__buf[message__ptr[i]];
-        if (!streq(old, str))
-            continue;
-
-        x = message__next++;
-        if (message__next == MESSAGE_MAX)
-            message__next = 0;
-        if (message__next == message__last)
-            message__last++;
-        if (message__last == MESSAGE_MAX)
-            message__last = 0;
-
-        message__ptr[x] = message__ptr[i];
+    u32b hash = message_hash(str);
+    s32b same = message_find_recent(str, hash, k);
+    if (same >= 0) {
+        u32b x = message_next_index();
+        message_type *msg_ptr = &message__log[x];
+        message_type *same_ptr = &message__log[same];
+        msg_ptr->offset = same_ptr->offset;
+        msg_ptr->hash = same_ptr->hash;
+        msg_ptr->base_len = same_ptr->base_len;
+        msg_ptr->count = same_ptr->count;
+        msg_ptr->collapsible = same_ptr->collapsible;
+        message_link(x);
         if (splitted2 != NULL) {
             message_add(splitted2);
         }
@@ -207,7 +318,7 @@ void message_add(concptr str)
                 i = 0;
             if (i == message__next)
                 break;
-            if (message__ptr[i] >= message__head) {
+            if (message__log[i].offset >= message__head) {
                 message__last = i + 1;
             }
         }
@@ -228,21 +339,18 @@ void message_add(concptr str)
                 i = 0;
             if (i == message__next)
                 break;
-            if ((message__ptr[i] >= message__head) && (message__ptr[i] < message__tail)) {
+            if ((message__log[i].offset >= message__head) && (message__log[i].offset < message__tail)) {
                 message__last = i + 1;
             }
         }
     }
 
-    x = message__next++;
-    if (message__next == MESSAGE_MAX)
-        message__next = 0;
-    if (message__next == message__last)
-        message__last++;
-    if (message__last == MESSAGE_MAX)
-        message__last = 0;
-
-    message__ptr[x] = message__head;
+    u32b x = message_next_index();
+    message_type *msg_ptr = &message__log[x];
+    msg_ptr->offset = message__head;
+    msg_ptr->hash = hash;
+    message_parse(msg_ptr, str);
+    message_link(x);
     for (i = 0; i < n; i++) {
         message__buf[message__head + i] = str[i];
     }
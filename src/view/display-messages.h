@@ -15,11 +15,36 @@
  */
 #define MESSAGE_BUF 655360
 
+/*
+ * Number of buckets of the hash table of recent messages (must be a power of 2)
+ */
+#define MESSAGE_HASH_SIZE 4096
+
+/*
+ * Number of recent messages searched for the same text
+ */
+#define MESSAGE_HASH_AGE (MESSAGE_MAX / 32)
+
+/*
+ * Record of a message in the log
+ */
+typedef struct message_type {
+    u32b offset; /* Offset of the text in message__buf */
+    u32b hash; /* Hash of the text */
+    u32b hash_next; /* Older message in the same hash bucket, as index + 1 */
+    u32b hash_prev; /* Newer message in the same hash bucket, as index + 1 */
+    int count; /* Repeat count given by the " <xN>" suffix */
+    u16b base_len; /* Length of the text without the " <xN>" suffix */
+    bool collapsible; /* A repeat of the message may be collapsed into it */
+    bool hashed; /* The message is in the hash table */
+} message_type;
+
 extern u32b message__next;
 extern u32b message__last;
 extern u32b message__head;
 extern u32b message__tail;
-extern u32b *message__ptr;
+extern message_type *message__log;
+extern u32b *message__hash;
 extern char *message__buf;
 
 extern bool msg_flag;
@@ -73,6 +73,7 @@ void print_map(player_type *player_ptr)
     (void)term_get_cursor(&v);
 
     (void)term_set_cursor(0);
+    reset_map_overview();
 
     floor_type *floor_ptr = player_ptr->current_floor_ptr;
     POSITION xmin = (0 < panel_col_min) ? panel_col_min : 0;
@@ -88,24 +89,35 @@ void print_map(player_type *player_ptr)
         term_erase(COL_MAP, y, wid);
     }
 
+    TERM_COLOR a[MAX_WID];
+    SYMBOL_CODE c[MAX_WID];
+    TERM_COLOR ta[MAX_WID];
+    SYMBOL_CODE tc[MAX_WID];
     for (POSITION y = ymin; y <= ymax; y++) {
-        for (POSITION x = xmin; x <= xmax; x++) {
-            TERM_COLOR a;
-            SYMBOL_CODE c;
-            TERM_COLOR ta;
-            SYMBOL_CODE tc;
-            map_info(player_ptr, y, x, &a, &c, &ta, &tc);
+        int n = 0;
+        for (POSITION x = xmin; x <= xmax; x++, n++) {
+            map_info(player_ptr, y, x, &a[n], &c[n], &ta[n], &tc[n]);
             if (!use_graphics) {
                 if (current_world_ptr->timewalk_m_idx)
-                    a = TERM_DARK;
+                    a[n] = TERM_DARK;
                 else if (is_invuln(player_ptr) || player_ptr->timewalk)
-                    a = TERM_WHITE;
+                    a[n] = TERM_WHITE;
                 else if (player_ptr->wraith_form)
-                    a = TERM_L_DARK;
+                    a[n] = TERM_L_DARK;
             }
+        }
+
+        if (n <= 0)
+            continue;
 
-            term_queue_bigchar(panel_col_of(x), y - panel_row_prt, a, c, ta, tc);
+        /* Queue the whole row at once unless each grid is drawn as a pair */
+        if (!use_bigtile) {
+            term_queue_line(panel_col_of(xmin), y - panel_row_prt, n, a, c, ta, tc);
+            continue;
         }
+
+        for (int i = 0; i < n; i++)
+            term_queue_bigchar(panel_col_of(xmin + i), y - panel_row_prt, a[i], c[i], ta[i], tc[i]);
     }
 
     lite_spot(player_ptr, player_ptr->y, player_ptr->x);
@@ -173,142 +185,238 @@ static void display_shortened_item_name(player_type *player_ptr, object_type *o_
     term_putstr(0, y, 12, attr, buf);
 }
 
-/*
- * Display a "small-scale" map of the dungeon in the active Term
+/*!
+ * @brief 縮小マップ表示用の各マスの描画結果 / The attr/char of each grid kept for the small-scale map
+ * @details
+ * 外周1マス分の余白を含む。
+ * priorityはmap_info()が求めた表示優先度で、自動拾い対象による補正前の値である。
  */
-void display_map(player_type *player_ptr, int *cy, int *cx)
-{
-    int i, j, x, y;
+typedef struct map_overview_type {
+    u32b key; //!< 描画結果を得た時の大域的な状態 (0は未計算)
+    byte display_autopick; //!< 描画結果を得た時の自動拾い表示設定
+    POSITION height; //!< 描画結果を得た時のフロアの高さ
+    POSITION width; //!< 描画結果を得た時のフロアの幅
+    TERM_LEN yrat; //!< 縮小区画の縦の比率
+    TERM_LEN xrat; //!< 縮小区画の横の比率
+    bool whole_changed; //!< 全マスの再計算が必要か
+    bool grid_changed[MAX_HGT][MAX_WID]; //!< 前回の表示以降に変化したマス
+    bool cell_changed[MAX_HGT + 2][MAX_WID + 2]; //!< 再計算が必要な縮小区画
+
+    TERM_COLOR bigma[MAX_HGT + 2][MAX_WID + 2];
+    SYMBOL_CODE bigmc[MAX_HGT + 2][MAX_WID + 2];
+    byte bigmp[MAX_HGT + 2][MAX_WID + 2];
+    int big_match_autopick[MAX_HGT + 2][MAX_WID + 2];
+    object_type *big_autopick_obj[MAX_HGT + 2][MAX_WID + 2];
+    byte tp[MAX_HGT][MAX_WID]; //!< 自動拾い対象による補正後の表示優先度
+
+    TERM_COLOR ma[MAX_HGT + 2][MAX_WID + 2];
+    SYMBOL_CODE mc[MAX_HGT + 2][MAX_WID + 2];
+    byte mp[MAX_HGT + 2][MAX_WID + 2];
+    int match_autopick_yx[MAX_HGT + 2][MAX_WID + 2];
+    object_type *object_autopick_yx[MAX_HGT + 2][MAX_WID + 2];
+} map_overview_type;
+
+static map_overview_type map_overview;
 
-    TERM_COLOR ta;
-    SYMBOL_CODE tc;
-
-    byte tp;
-
-    TERM_COLOR **bigma;
-    SYMBOL_CODE **bigmc;
-    byte **bigmp;
+/*!
+ * @brief 縮小マップの指定マスの再計算を予約する / Remember that a grid should be recalculated on the small-scale map
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y 変化したマスのY座標
+ * @param x 変化したマスのX座標
+ * @return なし
+ */
+void note_map_overview_grid(floor_type *floor_ptr, POSITION y, POSITION x)
+{
+    if (in_bounds2(floor_ptr, y, x))
+        map_overview.grid_changed[y][x] = TRUE;
+}
 
-    TERM_COLOR **ma;
-    SYMBOL_CODE **mc;
-    byte **mp;
+/*!
+ * @brief 縮小マップの全マスの再計算を予約する / Remember that every grid should be recalculated on the small-scale map
+ * @return なし
+ */
+void reset_map_overview(void) { map_overview.whole_changed = TRUE; }
 
-    bool old_view_special_lite = view_special_lite;
-    bool old_view_granite_lite = view_granite_lite;
-    TERM_LEN hgt, wid, yrat, xrat;
-    int **match_autopick_yx;
-    object_type ***object_autopick_yx;
-    term_get_size(&wid, &hgt);
-    hgt -= 2;
-    wid -= 14;
-    if (use_bigtile)
-        wid /= 2;
+/*!
+ * @brief 縮小区画1つ分の表示を求め直す / Recalculate a cell of the small-scale map from its grids
+ * @param floor_ptr 現在フロアへの参照ポインタ
+ * @param y 縮小区画のY座標
+ * @param x 縮小区画のX座標
+ * @return なし
+ */
+static void update_map_overview_cell(floor_type *floor_ptr, int y, int x)
+{
+    map_overview_type *mo_ptr = &map_overview;
+    int jmin = (y - 1) * mo_ptr->yrat;
+    int jmax = MIN(y * mo_ptr->yrat, floor_ptr->height);
+    int imin = (x - 1) * mo_ptr->xrat;
+    int imax = MIN(x * mo_ptr->xrat, floor_ptr->width);
+
+    mo_ptr->ma[y][x] = TERM_WHITE;
+    mo_ptr->mc[y][x] = ' ';
+    mo_ptr->mp[y][x] = 0;
+    mo_ptr->match_autopick_yx[y][x] = -1;
+    mo_ptr->object_autopick_yx[y][x] = NULL;
+
+    for (int i = imin; i < imax; ++i) {
+        for (int j = jmin; j < jmax; ++j) {
+            int match = mo_ptr->big_match_autopick[j + 1][i + 1];
+            mo_ptr->tp[j][i] = mo_ptr->bigmp[j + 1][i + 1];
+            if (match != -1 && (mo_ptr->match_autopick_yx[y][x] == -1 || mo_ptr->match_autopick_yx[y][x] > match)) {
+                mo_ptr->match_autopick_yx[y][x] = match;
+                mo_ptr->object_autopick_yx[y][x] = mo_ptr->big_autopick_obj[j + 1][i + 1];
+                mo_ptr->tp[j][i] = 0x7f;
+            }
+        }
+    }
 
-    floor_type *floor_ptr = player_ptr->current_floor_ptr;
-    yrat = (floor_ptr->height + hgt - 1) / hgt;
-    xrat = (floor_ptr->width + wid - 1) / wid;
-    view_special_lite = FALSE;
-    view_granite_lite = FALSE;
+    for (int j = jmin; j < jmax; ++j) {
+        for (int i = imin; i < imax; ++i) {
+            SYMBOL_CODE tc = mo_ptr->bigmc[j + 1][i + 1];
+            TERM_COLOR ta = mo_ptr->bigma[j + 1][i + 1];
+            byte p = mo_ptr->tp[j][i];
+            if (mo_ptr->mp[y][x] == p) {
+                int cnt = 0;
+                for (int t = 0; t < 8; t++) {
+                    if (tc == mo_ptr->bigmc[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]] && ta == mo_ptr->bigma[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]])
+                        cnt++;
+                }
+                if (cnt <= 4)
+                    p++;
+            }
 
-    C_MAKE(ma, (hgt + 2), TERM_COLOR *);
-    C_MAKE(mc, (hgt + 2), char_ptr);
-    C_MAKE(mp, (hgt + 2), byte_ptr);
-    C_MAKE(match_autopick_yx, (hgt + 2), int *);
-    C_MAKE(object_autopick_yx, (hgt + 2), object_type **);
-    for (y = 0; y < (hgt + 2); y++) {
-        C_MAKE(ma[y], (wid + 2), TERM_COLOR);
-        C_MAKE(mc[y], (wid + 2), char);
-        C_MAKE(mp[y], (wid + 2), byte);
-        C_MAKE(match_autopick_yx[y], (wid + 2), int);
-        C_MAKE(object_autopick_yx[y], (wid + 2), object_type *);
-        for (x = 0; x < wid + 2; ++x) {
-            match_autopick_yx[y][x] = -1;
-            object_autopick_yx[y][x] = NULL;
-            ma[y][x] = TERM_WHITE;
-            mc[y][x] = ' ';
-            mp[y][x] = 0;
+            if (mo_ptr->mp[y][x] < p) {
+                mo_ptr->mc[y][x] = tc;
+                mo_ptr->ma[y][x] = ta;
+                mo_ptr->mp[y][x] = p;
+            }
         }
     }
+}
 
-    C_MAKE(bigma, (floor_ptr->height + 2), TERM_COLOR *);
-    C_MAKE(bigmc, (floor_ptr->height + 2), char_ptr);
-    C_MAKE(bigmp, (floor_ptr->height + 2), byte_ptr);
-    for (y = 0; y < (floor_ptr->height + 2); y++) {
-        C_MAKE(bigma[y], (floor_ptr->width + 2), TERM_COLOR);
-        C_MAKE(bigmc[y], (floor_ptr->width + 2), char);
-        C_MAKE(bigmp[y], (floor_ptr->width + 2), byte);
-        for (x = 0; x < floor_ptr->width + 2; ++x) {
-            bigma[y][x] = TERM_WHITE;
-            bigmc[y][x] = ' ';
-            bigmp[y][x] = 0;
+/*!
+ * @brief 変化したマスについて縮小マップの表示を求め直す / Bring the small-scale map up to date with the grids changed since the last display
+ * @param player_ptr プレーヤーへの参照ポインタ
+ * @param yrat 縮小区画の縦の比率
+ * @param xrat 縮小区画の横の比率
+ * @return なし
+ * @details
+ * 幻覚中や自動拾い対象の表示中、大域的な状態が変わった時は全マスを求め直す。
+ * 各マスの変化は周囲8マスの縮小区画の表示にも影響する。
+ */
+static void update_map_overview(player_type *player_ptr, TERM_LEN yrat, TERM_LEN xrat)
+{
+    map_overview_type *mo_ptr = &map_overview;
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    u32b key = get_map_info_cache_key(player_ptr);
+    bool whole_changed = mo_ptr->whole_changed || player_ptr->image || display_autopick || (mo_ptr->display_autopick != display_autopick)
+        || (mo_ptr->key != key) || (mo_ptr->height != floor_ptr->height) || (mo_ptr->width != floor_ptr->width);
+    if (whole_changed) {
+        for (int y = 0; y < MAX_HGT + 2; y++) {
+            for (int x = 0; x < MAX_WID + 2; x++) {
+                mo_ptr->bigma[y][x] = TERM_WHITE;
+                mo_ptr->bigmc[y][x] = ' ';
+                mo_ptr->bigmp[y][x] = 0;
+                mo_ptr->big_match_autopick[y][x] = -1;
+                mo_ptr->big_autopick_obj[y][x] = NULL;
+            }
         }
+
+        mo_ptr->key = key;
+        mo_ptr->display_autopick = display_autopick;
+        mo_ptr->height = floor_ptr->height;
+        mo_ptr->width = floor_ptr->width;
+        mo_ptr->whole_changed = FALSE;
     }
 
-    for (i = 0; i < floor_ptr->width; ++i) {
-        for (j = 0; j < floor_ptr->height; ++j) {
-            x = i / xrat + 1;
-            y = j / yrat + 1;
+    bool whole_cells_changed = whole_changed || (mo_ptr->yrat != yrat) || (mo_ptr->xrat != xrat);
+    mo_ptr->yrat = yrat;
+    mo_ptr->xrat = xrat;
+    for (int i = 0; i < floor_ptr->width; ++i) {
+        for (int j = 0; j < floor_ptr->height; ++j) {
+            if (!whole_changed && !mo_ptr->grid_changed[j][i])
+                continue;
 
+            mo_ptr->grid_changed[j][i] = FALSE;
             match_autopick = -1;
             autopick_obj = NULL;
             feat_priority = -1;
+            TERM_COLOR ta;
+            SYMBOL_CODE tc;
             map_info(player_ptr, j, i, &ta, &tc, &ta, &tc);
-            tp = (byte)feat_priority;
-            if (match_autopick != -1 && (match_autopick_yx[y][x] == -1 || match_autopick_yx[y][x] > match_autopick)) {
-                match_autopick_yx[y][x] = match_autopick;
-                object_autopick_yx[y][x] = autopick_obj;
-                tp = 0x7f;
-            }
+            mo_ptr->bigmc[j + 1][i + 1] = tc;
+            mo_ptr->bigma[j + 1][i + 1] = ta;
+            mo_ptr->bigmp[j + 1][i + 1] = (byte)feat_priority;
+            mo_ptr->big_match_autopick[j + 1][i + 1] = match_autopick;
+            mo_ptr->big_autopick_obj[j + 1][i + 1] = autopick_obj;
+            if (whole_cells_changed)
+                continue;
 
-            bigmc[j + 1][i + 1] = tc;
-            bigma[j + 1][i + 1] = ta;
-            bigmp[j + 1][i + 1] = tp;
+            for (int t = 0; t < 9; t++) {
+                int y = (j + ddy_ddd[t]) / yrat + 1;
+                int x = (i + ddx_ddd[t]) / xrat + 1;
+                if (in_bounds2(floor_ptr, j + ddy_ddd[t], i + ddx_ddd[t]))
+                    mo_ptr->cell_changed[y][x] = TRUE;
+            }
         }
     }
 
-    for (j = 0; j < floor_ptr->height; ++j) {
-        for (i = 0; i < floor_ptr->width; ++i) {
-            x = i / xrat + 1;
-            y = j / yrat + 1;
-
-            tc = bigmc[j + 1][i + 1];
-            ta = bigma[j + 1][i + 1];
-            tp = bigmp[j + 1][i + 1];
-            if (mp[y][x] == tp) {
-                int t;
-                int cnt = 0;
-
-                for (t = 0; t < 8; t++) {
-                    if (tc == bigmc[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]] && ta == bigma[j + 1 + ddy_cdd[t]][i + 1 + ddx_cdd[t]])
-                        cnt++;
-                }
-                if (cnt <= 4)
-                    tp++;
-            }
+    int cell_hgt = (floor_ptr->height + yrat - 1) / yrat;
+    int cell_wid = (floor_ptr->width + xrat - 1) / xrat;
+    for (int y = 1; y <= cell_hgt; y++) {
+        for (int x = 1; x <= cell_wid; x++) {
+            if (!whole_cells_changed && !mo_ptr->cell_changed[y][x])
+                continue;
 
-            if (mp[y][x] < tp) {
-                mc[y][x] = tc;
-                ma[y][x] = ta;
-                mp[y][x] = tp;
-            }
+            mo_ptr->cell_changed[y][x] = FALSE;
+            update_map_overview_cell(floor_ptr, y, x);
         }
     }
+}
+
+/*
+ * Display a "small-scale" map of the dungeon in the active Term
+ */
+void display_map(player_type *player_ptr, int *cy, int *cx)
+{
+    int x, y;
 
-    x = wid + 1;
-    y = hgt + 1;
+    bool old_view_special_lite = view_special_lite;
+    bool old_view_granite_lite = view_granite_lite;
+    TERM_LEN hgt, wid, yrat, xrat;
+    term_get_size(&wid, &hgt);
+    hgt -= 2;
+    wid -= 14;
+    if (use_bigtile)
+        wid /= 2;
 
-    mc[0][0] = mc[0][x] = mc[y][0] = mc[y][x] = '+';
-    for (x = 1; x <= wid; x++)
-        mc[0][x] = mc[y][x] = '-';
+    floor_type *floor_ptr = player_ptr->current_floor_ptr;
+    yrat = (floor_ptr->height + hgt - 1) / hgt;
+    xrat = (floor_ptr->width + wid - 1) / wid;
+    view_special_lite = FALSE;
+    view_granite_lite = FALSE;
 
-    for (y = 1; y <= hgt; y++)
-        mc[y][0] = mc[y][x] = '|';
+    update_map_overview(player_ptr, yrat, xrat);
 
+    map_overview_type *mo_ptr = &map_overview;
+    int cell_hgt = (floor_ptr->height + yrat - 1) / yrat;
+    int cell_wid = (floor_ptr->width + xrat - 1) / xrat;
     for (y = 0; y < hgt + 2; ++y) {
         term_gotoxy(COL_MAP, y);
         for (x = 0; x < wid + 2; ++x) {
-            ta = ma[y][x];
-            tc = mc[y][x];
+            TERM_COLOR ta = TERM_WHITE;
+            SYMBOL_CODE tc = ' ';
+            if ((y == 0 || y == hgt + 1) && (x == 0 || x == wid + 1))
+                tc = '+';
+            else if (y == 0 || y == hgt + 1)
+                tc = '-';
+            else if (x == 0 || x == wid + 1)
+                tc = '|';
+            else if (y <= cell_hgt && x <= cell_wid) {
+                ta = mo_ptr->ma[y][x];
+                tc = mo_ptr->mc[y][x];
+            }
+
             if (!use_graphics) {
                 if (current_world_ptr->timewalk_m_idx)
                     ta = TERM_DARK;
@@ -324,10 +432,10 @@ void display_map(player_type *player_ptr, int *cy, int *cx)
 
     for (y = 1; y < hgt + 1; ++y) {
         match_autopick = -1;
-        for (x = 1; x <= wid; x++) {
-            if (match_autopick_yx[y][x] != -1 && (match_autopick > match_autopick_yx[y][x] || match_autopick == -1)) {
-                match_autopick = match_autopick_yx[y][x];
-                autopick_obj = object_autopick_yx[y][x];
+        for (x = 1; (x <= wid) && (y <= cell_hgt) && (x <= cell_wid); x++) {
+            if (mo_ptr->match_autopick_yx[y][x] != -1 && (match_autopick > mo_ptr->match_autopick_yx[y][x] || match_autopick == -1)) {
+                match_autopick = mo_ptr->match_autopick_yx[y][x];
+                autopick_obj = mo_ptr->object_autopick_yx[y][x];
             }
         }
 
@@ -344,29 +452,6 @@ void display_map(player_type *player_ptr, int *cy, int *cx)
 
     view_special_lite = old_view_special_lite;
     view_granite_lite = old_view_granite_lite;
-
-    for (y = 0; y < (hgt + 2); y++) {
-        C_KILL(ma[y], (wid + 2), TERM_COLOR);
-        C_KILL(mc[y], (wid + 2), SYMBOL_CODE);
-        C_KILL(mp[y], (wid + 2), byte);
-        C_KILL(match_autopick_yx[y], (wid + 2), int);
-        C_KILL(object_autopick_yx[y], (wid + 2), object_type *);
-    }
-
-    C_KILL(ma, (hgt + 2), TERM_COLOR *);
-    C_KILL(mc, (hgt + 2), char_ptr);
-    C_KILL(mp, (hgt + 2), byte_ptr);
-    C_KILL(match_autopick_yx, (hgt + 2), int *);
-    C_KILL(object_autopick_yx, (hgt + 2), object_type **);
-    for (y = 0; y < (floor_ptr->height + 2); y++) {
-        C_KILL(bigma[y], (floor_ptr->width + 2), TERM_COLOR);
-        C_KILL(bigmc[y], (floor_ptr->width + 2), SYMBOL_CODE);
-        C_KILL(bigmp[y], (floor_ptr->width + 2), byte);
-    }
-
-    C_KILL(bigma, (floor_ptr->height + 2), TERM_COLOR *);
-    C_KILL(bigmc, (floor_ptr->height + 2), char_ptr);
-    C_KILL(bigmp, (floor_ptr->height + 2), byte_ptr);
 }
 
 void set_term_color(player_type *player_ptr, POSITION y, POSITION x, TERM_COLOR *ap, SYMBOL_CODE *cp)
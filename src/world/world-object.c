@@ -42,6 +42,55 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
     return 0;
 }
 
+/* get_obj_num() が最後に第3次確率を計算した条件 / The pass 3 of the kind table was made for these */
+static DEPTH obj_num_level = -1;
+static bool obj_num_forbid_chest = FALSE;
+static int obj_num_size = 0;
+
+/*!
+ * @brief オブジェクト生成テーブルの第3次確率を作り直させる /
+ * Notice that "prob2" of the "object allocation table" has been changed
+ * @return なし
+ */
+void reset_obj_num_table(void)
+{
+    obj_num_level = -1;
+}
+
+/*!
+ * @brief オブジェクト生成テーブルの第3次確率を計算する /
+ * Fill in "prob3" and the running total of the "object allocation table"
+ * @param level 生成階
+ * @param forbid_chest 箱を除外するならばTRUE
+ * @return なし
+ * @details
+ * 前回と同じ条件ならば計算済みのテーブルをそのまま使う。
+ */
+static void prepare_obj_num_table(DEPTH level, bool forbid_chest)
+{
+    if ((obj_num_level == level) && (obj_num_forbid_chest == forbid_chest))
+        return;
+
+    alloc_entry *table = alloc_kind_table;
+    s32b total = 0;
+    int i;
+    for (i = 0; i < alloc_kind_size; i++) {
+        if (table[i].level > level)
+            break;
+
+        table[i].prob3 = 0;
+        if (!forbid_chest || (k_info[table[i].index].tval != TV_CHEST))
+            table[i].prob3 = table[i].prob2;
+
+        total += table[i].prob3;
+        table[i].total = total;
+    }
+
+    obj_num_level = level;
+    obj_num_forbid_chest = forbid_chest;
+    obj_num_size = i;
+}
+
 /*!
  * @brief オブジェクト生成テーブルからアイテムを取得する /
  * Choose an object kind that seems "appropriate" to the given level
@@ -64,9 +113,7 @@ OBJECT_IDX o_pop(floor_type *floor_ptr)
 OBJECT_IDX get_obj_num(player_type *owner_ptr, DEPTH level, BIT_FLAGS mode)
 {
     int i, j, p;
-    KIND_OBJECT_IDX k_idx;
     long value, total;
-    object_kind *k_ptr;
     alloc_entry *table = alloc_kind_table;
 
     if (level > MAX_DEPTH - 1)
@@ -78,44 +125,19 @@ OBJECT_IDX get_obj_num(player_type *owner_ptr, DEPTH level, BIT_FLAGS mode)
         }
     }
 
-    total = 0L;
-    for (i = 0; i < alloc_kind_size; i++) {
-        if (table[i].level > level)
-            break;
-
-        table[i].prob3 = 0;
-        k_idx = table[i].index;
-        k_ptr = &k_info[k_idx];
-
-        if ((mode & AM_FORBID_CHEST) && (k_ptr->tval == TV_CHEST))
-            continue;
-
-        table[i].prob3 = table[i].prob2;
-        total += table[i].prob3;
-    }
-
+    prepare_obj_num_table(level, (mode & AM_FORBID_CHEST) != 0);
+    total = (obj_num_size > 0) ? table[obj_num_size - 1].total : 0;
     if (total <= 0)
         return 0;
 
     value = randint0(total);
-    for (i = 0; i < alloc_kind_size; i++) {
-        if (value < table[i].prob3)
-            break;
-
-        value = value - table[i].prob3;
-    }
+    i = find_alloc_entry(table, obj_num_size, value);
 
     p = randint0(100);
     if (p < 60) {
         j = i;
         value = randint0(total);
-        for (i = 0; i < alloc_kind_size; i++) {
-            if (value < table[i].prob3)
-                break;
-
-            value = value - table[i].prob3;
-        }
-
+        i = find_alloc_entry(table, obj_num_size, value);
         if (table[i].level < table[j].level)
             i = j;
     }
@@ -125,13 +147,7 @@ OBJECT_IDX get_obj_num(player_type *owner_ptr, DEPTH level, BIT_FLAGS mode)
 
     j = i;
     value = randint0(total);
-    for (i = 0; i < alloc_kind_size; i++) {
-        if (value < table[i].prob3)
-            break;
-
-        value = value - table[i].prob3;
-    }
-
+    i = find_alloc_entry(table, obj_num_size, value);
     if (table[i].level < table[j].level)
         i = j;
     return (table[i].index);
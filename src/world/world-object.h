@@ -3,4 +3,5 @@
 #include "system/angband.h"
 
 OBJECT_IDX o_pop(floor_type *floor_ptr);
+void reset_obj_num_table(void);
 OBJECT_IDX get_obj_num(player_type *o_ptr, DEPTH level, BIT_FLAGS mode);
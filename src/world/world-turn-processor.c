@@ -27,6 +27,7 @@
 #include "object/lite-processor.h"
 #include "perception/simple-perception.h"
 #include "player/digestion-processor.h"
+#include "save/save.h"
 #include "store/store-util.h"
 #include "store/store.h"
 #include "system/floor-type-definition.h"
@@ -114,6 +115,7 @@ void process_world(player_type *player_ptr)
     if (current_world_ptr->game_turn % TURNS_PER_TICK)
         return;
 
+    finish_background_save(player_ptr, FALSE);
     if (autosave_t && autosave_freq && !player_ptr->phase_out) {
         if (!(current_world_ptr->game_turn % ((s32b)autosave_freq * TURNS_PER_TICK)))
             do_cmd_save_game(player_ptr, TRUE);